@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures a sender pipeline that computes y = a * x + y with bulk_chunked on
+// a static_thread_pool, from one thread to as many as the hardware has, and
+// compares it with the same pipeline run serially by sync_wait.
+//
+// The size of the vectors and the number of repetitions can be given on the
+// command line; they are small by default so that the example runs quickly as
+// a test.
+
+#include <cuda/std/array>
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace async = cuda::experimental::__async;
+
+struct saxpy
+{
+  float* x;
+  float* y;
+
+  void operator()(int begin, int end, float a) const noexcept
+  {
+    for (int i = begin; i < end; ++i)
+    {
+      y[i] = a * x[i] + y[i];
+    }
+  }
+};
+
+// The bandwidth in GB/s, counting a read of x and y and a write of y per element
+template <class F>
+double gb_per_second(int n, int repetitions, F f)
+{
+  auto const begin = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; ++r)
+  {
+    f();
+  }
+  auto const end = std::chrono::steady_clock::now();
+  double const bytes = 3.0 * sizeof(float) * n * repetitions;
+  return bytes / std::chrono::duration<double>(end - begin).count() / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+  int const n             = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+  int const repetitions   = argc > 2 ? std::atoi(argv[2]) : 10;
+  unsigned const hardware = std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<float> x(n, 1.0f);
+  std::vector<float> y(n, 0.0f);
+  saxpy const fn{x.data(), y.data()};
+  int runs = 0;
+
+  double const serial = gb_per_second(n, repetitions, [&] {
+    async::sync_wait(async::just(2.0f) | async::bulk_chunked(n, fn));
+    ++runs;
+  });
+  std::printf("%d elements\n%8s %12s\n%8s %12.2f\n", n, "threads", "GB/s", "serial", serial);
+
+  for (unsigned threads = 1;; threads = std::min(2 * threads, hardware))
+  {
+    async::static_thread_pool pool{threads};
+    double const parallel = gb_per_second(n, repetitions, [&] {
+      async::sync_wait(async::schedule(pool.get_scheduler()) | async::then([] {
+                         return 2.0f;
+                       })
+                       | async::bulk_chunked(n, fn));
+      ++runs;
+    });
+    std::printf("%8u %12.2f\n", threads, parallel);
+    if (threads == hardware)
+    {
+      break;
+    }
+  }
+
+  // every run adds 2 to every element of y
+  bool const correct = std::all_of(y.begin(), y.end(), [runs](float v) {
+    return v == 2.0f * runs;
+  });
+  if (!correct)
+  {
+    std::printf("incorrect result\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures how many tasks a run_loop schedules and completes per second when
+// a growing number of producer threads schedule onto it at once, while one
+// thread runs the loop.
+//
+// The number of tasks per producer and the largest number of producers can be
+// given on the command line; they are small by default so that the example
+// runs quickly as a test.
+
+#include <cuda/std/array>
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace async = cuda::experimental::__async;
+
+// Returns the number of tasks per second
+double schedule_and_complete(int producers, int tasks_per_producer)
+{
+  async::run_loop loop;
+  long completed = 0;
+
+  auto const begin = std::chrono::steady_clock::now();
+  std::thread consumer([&] {
+    loop.run();
+  });
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < tasks_per_producer; ++i)
+      {
+        async::start_detached(async::schedule(loop.get_scheduler()) | async::then([&completed] {
+                                ++completed;
+                              }));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  loop.finish();
+  consumer.join();
+  auto const end = std::chrono::steady_clock::now();
+
+  if (completed != long{producers} * tasks_per_producer)
+  {
+    std::printf("lost tasks\n");
+    std::exit(1);
+  }
+  return completed / std::chrono::duration<double>(end - begin).count();
+}
+
+int main(int argc, char** argv)
+{
+  int const tasks         = argc > 1 ? std::atoi(argv[1]) : 20000;
+  int const max_producers = argc > 2 ? std::atoi(argv[2]) : int(std::max(2u, std::thread::hardware_concurrency()));
+
+  std::printf("%d tasks per producer\n%10s %16s\n", tasks, "producers", "tasks/s");
+  for (int producers = 1;; producers = std::min(2 * producers, max_producers))
+  {
+    std::printf("%10d %16.0f\n", producers, schedule_and_complete(producers, tasks));
+    if (producers == max_producers)
+    {
+      break;
+    }
+  }
+  return 0;
+}
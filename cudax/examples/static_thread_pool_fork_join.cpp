@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the throughput of a static_thread_pool on two fork/join workloads,
+// from one thread to as many as the hardware has:
+//
+// * spawn: every task of a binary tree schedules its two children from the
+//   worker that runs it, so that the tasks go to the deque of that worker and
+//   the other workers have to steal them.
+// * flat: the main thread schedules all of the tasks, so that they go through
+//   the shared queue of the pool.
+//
+// The depth of the tree can be given on the command line; it is small by
+// default so that the example runs quickly as a test.
+
+#include <cuda/std/array>
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace async = cuda::experimental::__async;
+
+struct fork_join
+{
+  async::static_thread_pool& pool;
+  std::atomic<long>& pending;
+
+  void spawn(int depth) const
+  {
+    async::start_detached(async::schedule(pool.get_scheduler()) | async::then([*this, depth] {
+                            if (depth > 0)
+                            {
+                              spawn(depth - 1);
+                              spawn(depth - 1);
+                            }
+                            pending.fetch_sub(1, std::memory_order_release);
+                          }));
+  }
+};
+
+void wait_for(std::atomic<long>& pending)
+{
+  while (pending.load(std::memory_order_acquire) != 0)
+  {
+    std::this_thread::yield();
+  }
+}
+
+template <class F>
+double tasks_per_second(long tasks, F f)
+{
+  auto const begin = std::chrono::steady_clock::now();
+  f();
+  auto const end = std::chrono::steady_clock::now();
+  return tasks / std::chrono::duration<double>(end - begin).count();
+}
+
+int main(int argc, char** argv)
+{
+  int const depth         = argc > 1 ? std::atoi(argv[1]) : 14;
+  long const tasks        = (2l << depth) - 1;
+  unsigned const hardware = std::max(1u, std::thread::hardware_concurrency());
+
+  std::printf("%ld tasks\n%8s %16s %16s\n", tasks, "threads", "spawn tasks/s", "flat tasks/s");
+  for (unsigned threads = 1;; threads = std::min(2 * threads, hardware))
+  {
+    async::static_thread_pool pool{threads};
+    std::atomic<long> pending{0};
+
+    double const spawn = tasks_per_second(tasks, [&] {
+      pending.store(tasks);
+      fork_join{pool, pending}.spawn(depth);
+      wait_for(pending);
+    });
+
+    double const flat = tasks_per_second(tasks, [&] {
+      pending.store(tasks);
+      for (long i = 0; i < tasks; ++i)
+      {
+        fork_join{pool, pending}.spawn(0);
+      }
+      wait_for(pending);
+    });
+
+    std::printf("%8u %16.0f %16.0f\n", threads, spawn, flat);
+    if (threads == hardware)
+    {
+      break;
+    }
+  }
+  return 0;
+}
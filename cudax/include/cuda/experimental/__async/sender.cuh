@@ -25,23 +25,26 @@
 #include <cuda/experimental/__detail/config.cuh> // IWYU pragma: export
 
 // Include the other implementation headers:
-#include <cuda/experimental/__async/sender/conditional.cuh>    // IWYU pragma: export
-#include <cuda/experimental/__async/sender/continue_on.cuh>    // IWYU pragma: export
-#include <cuda/experimental/__async/sender/cpos.cuh>           // IWYU pragma: export
-#include <cuda/experimental/__async/sender/just.cuh>           // IWYU pragma: export
-#include <cuda/experimental/__async/sender/just_from.cuh>      // IWYU pragma: export
-#include <cuda/experimental/__async/sender/let_value.cuh>      // IWYU pragma: export
-#include <cuda/experimental/__async/sender/queries.cuh>        // IWYU pragma: export
-#include <cuda/experimental/__async/sender/read_env.cuh>       // IWYU pragma: export
-#include <cuda/experimental/__async/sender/run_loop.cuh>       // IWYU pragma: export
-#include <cuda/experimental/__async/sender/sequence.cuh>       // IWYU pragma: export
-#include <cuda/experimental/__async/sender/start_detached.cuh> // IWYU pragma: export
-#include <cuda/experimental/__async/sender/start_on.cuh>       // IWYU pragma: export
-#include <cuda/experimental/__async/sender/stop_token.cuh>     // IWYU pragma: export
-#include <cuda/experimental/__async/sender/sync_wait.cuh>      // IWYU pragma: export
-#include <cuda/experimental/__async/sender/then.cuh>           // IWYU pragma: export
-#include <cuda/experimental/__async/sender/thread_context.cuh> // IWYU pragma: export
-#include <cuda/experimental/__async/sender/when_all.cuh>       // IWYU pragma: export
-#include <cuda/experimental/__async/sender/write_env.cuh>      // IWYU pragma: export
+#include <cuda/experimental/__async/sender/bulk.cuh>               // IWYU pragma: export
+#include <cuda/experimental/__async/sender/conditional.cuh>        // IWYU pragma: export
+#include <cuda/experimental/__async/sender/continue_on.cuh>        // IWYU pragma: export
+#include <cuda/experimental/__async/sender/cpos.cuh>               // IWYU pragma: export
+#include <cuda/experimental/__async/sender/just.cuh>               // IWYU pragma: export
+#include <cuda/experimental/__async/sender/just_from.cuh>          // IWYU pragma: export
+#include <cuda/experimental/__async/sender/let_value.cuh>          // IWYU pragma: export
+#include <cuda/experimental/__async/sender/queries.cuh>            // IWYU pragma: export
+#include <cuda/experimental/__async/sender/read_env.cuh>           // IWYU pragma: export
+#include <cuda/experimental/__async/sender/run_loop.cuh>           // IWYU pragma: export
+#include <cuda/experimental/__async/sender/sequence.cuh>           // IWYU pragma: export
+#include <cuda/experimental/__async/sender/split.cuh>              // IWYU pragma: export
+#include <cuda/experimental/__async/sender/start_detached.cuh>     // IWYU pragma: export
+#include <cuda/experimental/__async/sender/start_on.cuh>           // IWYU pragma: export
+#include <cuda/experimental/__async/sender/static_thread_pool.cuh> // IWYU pragma: export
+#include <cuda/experimental/__async/sender/stop_token.cuh>         // IWYU pragma: export
+#include <cuda/experimental/__async/sender/sync_wait.cuh>          // IWYU pragma: export
+#include <cuda/experimental/__async/sender/then.cuh>               // IWYU pragma: export
+#include <cuda/experimental/__async/sender/thread_context.cuh>     // IWYU pragma: export
+#include <cuda/experimental/__async/sender/when_all.cuh>           // IWYU pragma: export
+#include <cuda/experimental/__async/sender/write_env.cuh>          // IWYU pragma: export
 
 #endif // __CUDAX_ASYNC_DETAIL_ASYNC
@@ -0,0 +1,413 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_BULK
+#define __CUDAX_ASYNC_DETAIL_BULK
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cccl/unreachable.h>
+#include <cuda/std/__type_traits/is_callable.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__async/sender/completion_signatures.cuh>
+#include <cuda/experimental/__async/sender/concepts.cuh>
+#include <cuda/experimental/__async/sender/cpos.cuh>
+#include <cuda/experimental/__async/sender/exception.cuh>
+#include <cuda/experimental/__async/sender/meta.cuh>
+#include <cuda/experimental/__async/sender/queries.cuh>
+#include <cuda/experimental/__async/sender/rcvr_ref.cuh>
+#include <cuda/experimental/__async/sender/tuple.cuh>
+#include <cuda/experimental/__async/sender/utility.cuh>
+#include <cuda/experimental/__async/sender/variant.cuh>
+
+#include <cuda/experimental/__async/sender/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+// Forward-declare the bulk algorithm tag types:
+struct bulk_t;
+struct bulk_chunked_t;
+
+// A scheduler customizes how bulk executes on it with a member function
+//
+//   template <class _Op, class _Shape>
+//   void __bulk_execute(_Op& __op, _Shape __shape) noexcept;
+//
+// which must call __op.__execute(__begin, __end) for every chunk of a
+// partition of [0, __shape), possibly concurrently, and then __op.__complete()
+// exactly once, after all of the chunks have been executed. A bulk operation
+// whose predecessor completes on a scheduler without it executes the whole
+// shape as one chunk on the thread of that completion.
+template <class _Sch, class _Op, class _Shape>
+using __bulk_execute_result_t = decltype(declval<_Sch&>().__bulk_execute(declval<_Op&>(), declval<_Shape>()));
+
+template <class _Sch, class _Op, class _Shape>
+inline constexpr bool __has_bulk_execute = __type_valid_v<__bulk_execute_result_t, _Sch, _Op, _Shape>;
+
+// The scheduler on which the values of a bulk operation's predecessor are
+// produced: the completion scheduler of the predecessor if it has one, or
+// else the current scheduler of the receiver's environment.
+template <class _Sndr, class _Rcvr>
+_CUDAX_API auto __bulk_scheduler(const _Sndr& __sndr, const _Rcvr& __rcvr) noexcept
+{
+  if constexpr (__queryable_with<env_of_t<_Sndr>, get_completion_scheduler_t<set_value_t>>)
+  {
+    return get_completion_scheduler<set_value_t>(__async::get_env(__sndr));
+  }
+  else if constexpr (__queryable_with<env_of_t<_Rcvr>, get_scheduler_t>)
+  {
+    return get_scheduler(__async::get_env(__rcvr));
+  }
+  else
+  {
+    return __nil{};
+  }
+}
+
+template <bool _Chunked>
+struct __bulk_t
+{
+private:
+  using _BulkTag = _CUDA_VSTD::conditional_t<_Chunked, bulk_chunked_t, bulk_t>;
+
+  template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using __env_t                 = _FWD_ENV_T<env_of_t<_Rcvr>>;
+    using __sch_t                 = decltype(__async::__bulk_scheduler(declval<_CvSndr>(), declval<_Rcvr&>()));
+
+    // The values of the predecessor are stored so that every chunk can be
+    // passed lvalue references to them, and so that they can be sent to the
+    // receiver after the last chunk.
+    using __values_t = __gather_completion_signatures<completion_signatures_of_t<_CvSndr, __env_t>,
+                                                      set_value_t,
+                                                      __decayed_tuple,
+                                                      __variant>;
+
+    using __execute_fn_t  = void(__opstate_t*, _Shape, _Shape) noexcept;
+    using __complete_fn_t = void(__opstate_t*) noexcept;
+
+    _CUDAX_API __opstate_t(_CvSndr&& __sndr, _Rcvr __rcvr, _Shape __shape, _Fn __fn)
+        : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+        , __shape_{__shape}
+        , __fn_{static_cast<_Fn&&>(__fn)}
+        , __sch_{__async::__bulk_scheduler(__sndr, __rcvr_)}
+        , __opstate_{__async::connect(static_cast<_CvSndr&&>(__sndr), __rcvr_ref{*this})}
+    {}
+
+    _CUDAX_IMMOVABLE(__opstate_t);
+
+    _CUDAX_API void start() & noexcept
+    {
+      __async::start(__opstate_);
+    }
+
+    // Calls the function for the chunk [__begin, __end) of the shape. May be
+    // called concurrently for disjoint chunks.
+    _CUDAX_API void __execute(_Shape __begin, _Shape __end) noexcept
+    {
+      (*__execute_fn_)(this, __begin, __end);
+    }
+
+    // Sends the values, or the first exception thrown by the function, to the
+    // receiver.
+    _CUDAX_API void __complete() noexcept
+    {
+      // the scheduler orders the chunks before the completion
+      if (__failed_.load(_CUDA_VSTD::memory_order_relaxed))
+      {
+        __async::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<::std::exception_ptr&&>(__error_));
+      }
+      else
+      {
+        (*__complete_fn_)(this);
+      }
+    }
+
+    template <class _Tupl>
+    _CUDAX_API static void __execute_impl(__opstate_t* __self, _Shape __begin, _Shape __end) noexcept
+    {
+      auto& __tupl = *static_cast<_Tupl*>(__self->__values_.__ptr());
+      _CUDAX_TRY( //
+        ({        //
+          if constexpr (_Chunked)
+          {
+            __tupl.__apply(__self->__fn_, __tupl, __begin, __end);
+          }
+          else
+          {
+            for (_Shape __i = __begin; __i < __end; ++__i)
+            {
+              __tupl.__apply(__self->__fn_, __tupl, _Shape(__i));
+            }
+          }
+        }),
+        _CUDAX_CATCH(...) //
+        ({                //
+          if (!__self->__failed_.exchange(true, _CUDA_VSTD::memory_order_relaxed))
+          {
+            __self->__error_ = ::std::current_exception();
+          }
+        }) //
+      )
+    }
+
+    template <class _Tupl>
+    _CUDAX_API static void __complete_impl(__opstate_t* __self) noexcept
+    {
+      auto& __tupl = *static_cast<_Tupl*>(__self->__values_.__ptr());
+      __tupl.__apply(__async::set_value, static_cast<_Tupl&&>(__tupl), static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+
+    template <class... _As>
+    _CUDAX_API void set_value(_As&&... __as) noexcept
+    {
+      using __tupl_t = __decayed_tuple<_As...>;
+      _CUDAX_TRY( //
+        ({        //
+          __values_.template __emplace<__tupl_t>(static_cast<_As&&>(__as)...);
+        }),
+        _CUDAX_CATCH(...) //
+        ({                //
+          __async::set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception());
+          return;
+        }) //
+      )
+      __execute_fn_  = &__execute_impl<__tupl_t>;
+      __complete_fn_ = &__complete_impl<__tupl_t>;
+
+      if constexpr (__has_bulk_execute<__sch_t, __opstate_t, _Shape>)
+      {
+        __sch_.__bulk_execute(*this, __shape_);
+      }
+      else
+      {
+        // like a pool, treat a shape that is not positive as empty
+        if (_Shape(0) < __shape_)
+        {
+          __execute(_Shape(0), __shape_);
+        }
+        __complete();
+      }
+    }
+
+    template <class _Error>
+    _CUDAX_API void set_error(_Error&& __error) noexcept
+    {
+      __async::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Error&&>(__error));
+    }
+
+    _CUDAX_API void set_stopped() noexcept
+    {
+      __async::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+    }
+
+    _CUDAX_API auto get_env() const noexcept -> __env_t
+    {
+      return __async::get_env(__rcvr_);
+    }
+
+    _Rcvr __rcvr_;
+    _Shape __shape_;
+    _Fn __fn_;
+    _CCCL_NO_UNIQUE_ADDRESS __sch_t __sch_;
+    __values_t __values_{};
+    __execute_fn_t* __execute_fn_   = nullptr;
+    __complete_fn_t* __complete_fn_ = nullptr;
+    _CUDA_VSTD::atomic<bool> __failed_{false};
+    ::std::exception_ptr __error_{};
+    connect_result_t<_CvSndr, __rcvr_ref<__opstate_t, __env_t>> __opstate_;
+  };
+
+  template <class _Shape, class _Fn>
+  struct __transform_args_fn
+  {
+    // The function is called with a chunk or an index of the shape, followed
+    // by lvalue references to the stored values
+    template <class... _Ts>
+    _CUDAX_API static constexpr bool __is_callable() noexcept
+    {
+      if constexpr (_Chunked)
+      {
+        return __callable<_Fn&, _Shape, _Shape, _Ts&...>;
+      }
+      else
+      {
+        return __callable<_Fn&, _Shape, _Ts&...>;
+      }
+    }
+
+    template <class... _Ts>
+    _CUDAX_API static constexpr bool __is_nothrow_callable() noexcept
+    {
+      if constexpr (_Chunked)
+      {
+        return __nothrow_callable<_Fn&, _Shape, _Shape, _Ts&...>;
+      }
+      else
+      {
+        return __nothrow_callable<_Fn&, _Shape, _Ts&...>;
+      }
+    }
+
+    template <class... _Ts>
+    _CUDAX_API constexpr auto operator()() const
+    {
+      if constexpr (!__decay_copyable<_Ts...>)
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, _BulkTag),
+                                            _WHAT(_ARGUMENTS_ARE_NOT_DECAY_COPYABLE),
+                                            _WITH_ARGUMENTS(_Ts...)>();
+      }
+      else if constexpr (!__is_callable<__decay_t<_Ts>...>())
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, _BulkTag),
+                                            _WHAT(_FUNCTION_IS_NOT_CALLABLE),
+                                            _WITH_FUNCTION(_Fn),
+                                            _WITH_ARGUMENTS(_Shape, __decay_t<_Ts> & ...)>();
+      }
+      else if constexpr (!__nothrow_decay_copyable<_Ts...> || !__is_nothrow_callable<__decay_t<_Ts>...>())
+      {
+        return completion_signatures<set_value_t(__decay_t<_Ts>...), set_error_t(::std::exception_ptr)>{};
+      }
+      else
+      {
+        return completion_signatures<set_value_t(__decay_t<_Ts>...)>{};
+      }
+    }
+  };
+
+public:
+  template <class _Sndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  template <class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t;
+
+  template <class _Sndr, class _Shape, class _Fn>
+  _CUDAX_TRIVIAL_API auto operator()(_Sndr __sndr, _Shape __shape, _Fn __fn) const -> __sndr_t<_Sndr, _Shape, _Fn>;
+
+  template <class _Shape, class _Fn>
+  _CUDAX_TRIVIAL_API auto operator()(_Shape __shape, _Fn __fn) const noexcept -> __closure_t<_Shape, _Fn>;
+};
+
+template <bool _Chunked>
+template <class _Sndr, class _Shape, class _Fn>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_t<_Chunked>::__sndr_t
+{
+  using sender_concept = sender_t;
+  _CCCL_NO_UNIQUE_ADDRESS _BulkTag __tag_;
+  _Shape __shape_;
+  _Fn __fn_;
+  _Sndr __sndr_;
+
+  template <class _Self, class... _Env>
+  _CUDAX_API static constexpr auto get_completion_signatures()
+  {
+    _CUDAX_LET_COMPLETIONS(auto(__child_completions) = get_child_completion_signatures<_Self, _Sndr, _Env...>())
+    {
+      return transform_completion_signatures(__child_completions, __transform_args_fn<_Shape, _Fn>{});
+    }
+
+    _CCCL_UNREACHABLE();
+  }
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) && -> __opstate_t<_Rcvr, _Sndr, _Shape, _Fn>
+  {
+    return __opstate_t<_Rcvr, _Sndr, _Shape, _Fn>{
+      static_cast<_Sndr&&>(__sndr_), static_cast<_Rcvr&&>(__rcvr), __shape_, static_cast<_Fn&&>(__fn_)};
+  }
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) const& -> __opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>
+  {
+    return __opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>{__sndr_, static_cast<_Rcvr&&>(__rcvr), __shape_, __fn_};
+  }
+
+  _CUDAX_API env_of_t<_Sndr> get_env() const noexcept
+  {
+    return __async::get_env(__sndr_);
+  }
+};
+
+template <bool _Chunked>
+template <class _Shape, class _Fn>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_t<_Chunked>::__closure_t
+{
+  _Shape __shape_;
+  _Fn __fn_;
+
+  template <class _Sndr>
+  _CUDAX_TRIVIAL_API auto operator()(_Sndr __sndr) -> __call_result_t<_BulkTag, _Sndr, _Shape, _Fn>
+  {
+    return _BulkTag()(static_cast<_Sndr&&>(__sndr), __shape_, static_cast<_Fn&&>(__fn_));
+  }
+
+  template <class _Sndr>
+  _CUDAX_TRIVIAL_API friend auto operator|(_Sndr __sndr, __closure_t&& __self) //
+    -> __call_result_t<_BulkTag, _Sndr, _Shape, _Fn>
+  {
+    return _BulkTag()(static_cast<_Sndr&&>(__sndr), __self.__shape_, static_cast<_Fn&&>(__self.__fn_));
+  }
+};
+
+template <bool _Chunked>
+template <class _Sndr, class _Shape, class _Fn>
+_CUDAX_TRIVIAL_API auto __bulk_t<_Chunked>::operator()(_Sndr __sndr, _Shape __shape, _Fn __fn) const
+  -> __sndr_t<_Sndr, _Shape, _Fn>
+{
+  static_assert(_CUDA_VSTD::is_integral_v<_Shape>, "The shape of a bulk operation must be an integer");
+  // If the incoming sender is non-dependent, we can check the completion
+  // signatures of the composed sender immediately.
+  if constexpr (!dependent_sender<_Sndr>)
+  {
+    using __completions = completion_signatures_of_t<__sndr_t<_Sndr, _Shape, _Fn>>;
+    static_assert(__valid_completion_signatures<__completions>);
+  }
+  return __sndr_t<_Sndr, _Shape, _Fn>{{}, __shape, static_cast<_Fn&&>(__fn), static_cast<_Sndr&&>(__sndr)};
+}
+
+template <bool _Chunked>
+template <class _Shape, class _Fn>
+_CUDAX_TRIVIAL_API auto __bulk_t<_Chunked>::operator()(_Shape __shape, _Fn __fn) const noexcept
+  -> __closure_t<_Shape, _Fn>
+{
+  return __closure_t<_Shape, _Fn>{__shape, static_cast<_Fn&&>(__fn)};
+}
+
+//! bulk(sndr, shape, fn) calls fn(i, values&...) for every i in [0, shape)
+//! with the values of sndr, and then completes with them.
+_CCCL_GLOBAL_CONSTANT struct bulk_t : __bulk_t<false>
+{
+} bulk{};
+
+//! bulk_chunked(sndr, shape, fn) calls fn(begin, end, values&...) for the
+//! chunks of a partition of [0, shape) into ranges [begin, end), with the
+//! values of sndr, and then completes with them.
+_CCCL_GLOBAL_CONSTANT struct bulk_chunked_t : __bulk_t<true>
+{
+} bulk_chunked{};
+} // namespace cuda::experimental::__async
+
+#include <cuda/experimental/__async/sender/epilogue.cuh>
+
+#endif
@@ -23,18 +23,18 @@
 
 #include <cuda/experimental/__detail/config.cuh>
 
-// libcu++ does not have <cuda/std/mutex> or <cuda/std/condition_variable>
+// The consumer of a run_loop is a host thread
 #if !defined(__CUDA_ARCH__)
 
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstdint>
+
 #  include <cuda/experimental/__async/sender/completion_signatures.cuh>
 #  include <cuda/experimental/__async/sender/env.cuh>
 #  include <cuda/experimental/__async/sender/exception.cuh>
 #  include <cuda/experimental/__async/sender/queries.cuh>
 #  include <cuda/experimental/__async/sender/utility.cuh>
 
-#  include <condition_variable>
-#  include <mutex>
-
 #  include <cuda/experimental/__async/sender/prologue.cuh>
 
 namespace cuda::experimental::__async
@@ -47,23 +47,12 @@ struct __task : __immovable
 
   _CUDAX_DEFAULTED_API __task() = default;
 
-  _CUDAX_API explicit __task(__task* __next, __task* __tail) noexcept
-      : __next_{__next}
-      , __tail_{__tail}
-  {}
-
-  _CUDAX_API explicit __task(__task* __next, __execute_fn_t* __execute) noexcept
-      : __next_{__next}
-      , __execute_fn_{__execute}
+  _CUDAX_API explicit __task(__execute_fn_t* __execute) noexcept
+      : __execute_fn_{__execute}
   {}
 
-  __task* __next_ = this;
-
-  union
-  {
-    __task* __tail_ = nullptr;
-    __execute_fn_t* __execute_fn_;
-  };
+  __task* __next_                = nullptr;
+  __execute_fn_t* __execute_fn_ = nullptr;
 
   _CUDAX_API void __execute() noexcept
   {
@@ -98,12 +87,8 @@ struct __operation : __task
     )
   }
 
-  _CUDAX_API explicit __operation(__task* __tail_) noexcept
-      : __task{this, __tail_}
-  {}
-
-  _CUDAX_API __operation(__task* __next_, run_loop* __loop, _Rcvr __rcvr)
-      : __task{__next_, &__execute_impl}
+  _CUDAX_API __operation(run_loop* __loop, _Rcvr __rcvr)
+      : __task{&__execute_impl}
       , __loop_{__loop}
       , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
   {}
@@ -120,10 +105,7 @@ class run_loop
   friend struct __operation;
 
 public:
-  run_loop() noexcept
-  {
-    __head.__next_ = __head.__tail_ = &__head;
-  }
+  run_loop() noexcept = default;
 
   class __scheduler
   {
@@ -136,7 +118,7 @@ public:
       template <class _Rcvr>
       _CUDAX_API auto connect(_Rcvr __rcvr) const noexcept -> __operation<_Rcvr>
       {
-        return {&__loop_->__head, __loop_, static_cast<_Rcvr&&>(__rcvr)};
+        return {__loop_, static_cast<_Rcvr&&>(__rcvr)};
       }
 
       template <class _Self>
@@ -213,62 +195,98 @@ public:
   _CUDAX_API void finish();
 
 private:
-  _CUDAX_API void __push_back(__task* __tsk);
-  _CUDAX_API auto __pop_front() -> __task*;
-
-  ::std::mutex __mutex{};
-  ::std::condition_variable __cv{};
-  __task __head{};
-  bool __stop = false;
+  _CUDAX_API void __push_back(__task* __tsk) noexcept;
+
+  // The scheduled tasks, most recently scheduled first. Any thread pushes a
+  // task with a compare-and-swap, and run() takes all of them at once, so
+  // neither side ever blocks the other.
+  ::cuda::std::atomic<__task*> __queue_{nullptr};
+
+  // Bumped by every push onto an empty queue. run() waits on it rather than
+  // on the queue, so that it parks on a 32-bit word.
+  ::cuda::std::atomic<::cuda::std::uint32_t> __epoch_{0};
+
+  // Scheduled by finish(), so that run() returns once it has run every task
+  // that was scheduled before
+  __task __finish_{};
+  ::cuda::std::atomic<bool> __finish_scheduled_{false};
+  bool __finishing_ = false;
 };
 
 template <class _Rcvr>
-_CUDAX_API inline void __operation<_Rcvr>::start() & noexcept {
-  _CUDAX_TRY(                                                               //
-    ({                                                                      //
-      __loop_->__push_back(this);                                           //
-    }),                                                                     //
-    _CUDAX_CATCH(...)                                                       //
-    ({                                                                      //
-      set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception()); //
-    })                                                                      //
-    )                                                                       //
+_CUDAX_API inline void __operation<_Rcvr>::start() & noexcept
+{
+  __loop_->__push_back(this);
 }
 
 _CUDAX_API inline void run_loop::run()
 {
-  for (__task* __tsk = __pop_front(); __tsk != &__head; __tsk = __pop_front())
+  for (;;)
   {
-    __tsk->__execute();
+    // read before taking the queue, so that a push onto the queue emptied here
+    // changes it
+    const ::cuda::std::uint32_t __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+    __task* __batch                     = __queue_.exchange(nullptr, ::cuda::std::memory_order_acquire);
+    if (__batch == nullptr)
+    {
+      if (__finishing_)
+      {
+        return;
+      }
+      __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+      continue;
+    }
+
+    // put the batch in the order in which it was scheduled
+    __task* __fifo = nullptr;
+    while (__batch != nullptr)
+    {
+      __task* const __next = __batch->__next_;
+      __batch->__next_     = __fifo;
+      __fifo               = __batch;
+      __batch              = __next;
+    }
+
+    while (__fifo != nullptr)
+    {
+      // executing a task may destroy it
+      __task* const __next = __fifo->__next_;
+      if (__fifo == &__finish_)
+      {
+        __finishing_ = true;
+      }
+      else
+      {
+        __fifo->__execute();
+      }
+      __fifo = __next;
+    }
   }
 }
 
 _CUDAX_API inline void run_loop::finish()
 {
-  ::std::unique_lock __lock{__mutex};
-  __stop = true;
-  __cv.notify_all();
+  if (!__finish_scheduled_.exchange(true, ::cuda::std::memory_order_relaxed))
+  {
+    __push_back(&__finish_);
+  }
 }
 
-_CUDAX_API inline void run_loop::__push_back(__task* __tsk)
+_CUDAX_API inline void run_loop::__push_back(__task* __tsk) noexcept
 {
-  ::std::unique_lock __lock{__mutex};
-  __tsk->__next_ = &__head;
-  __head.__tail_ = __head.__tail_->__next_ = __tsk;
-  __cv.notify_one();
-}
+  __task* __head = __queue_.load(::cuda::std::memory_order_relaxed);
+  do
+  {
+    __tsk->__next_ = __head;
+  } while (!__queue_.compare_exchange_weak(
+    __head, __tsk, ::cuda::std::memory_order_release, ::cuda::std::memory_order_relaxed));
 
-_CUDAX_API inline auto run_loop::__pop_front() -> __task*
-{
-  ::std::unique_lock __lock{__mutex};
-  __cv.wait(__lock, [this] {
-    return __head.__next_ != &__head || __stop;
-  });
-  if (__head.__tail_ == __head.__next_)
+  // run() only ever waits for the queue to become non-empty
+  if (__head == nullptr)
   {
-    __head.__tail_ = &__head;
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+    __epoch_.notify_one();
   }
-  return __async::__exchange(__head.__next_, __head.__next_->__next_);
 }
 } // namespace cuda::experimental::__async
 
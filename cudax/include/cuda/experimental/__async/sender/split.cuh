@@ -0,0 +1,526 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_SPLIT
+#define __CUDAX_ASYNC_DETAIL_SPLIT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__detail/config.cuh>
+
+// The shared state is allocated and reference counted by host threads
+#if !defined(__CUDA_ARCH__)
+
+#  include <cuda/std/__utility/exchange.h>
+#  include <cuda/std/atomic>
+
+#  include <cuda/experimental/__async/sender/completion_signatures.cuh>
+#  include <cuda/experimental/__async/sender/cpos.cuh>
+#  include <cuda/experimental/__async/sender/env.cuh>
+#  include <cuda/experimental/__async/sender/exception.cuh>
+#  include <cuda/experimental/__async/sender/meta.cuh>
+#  include <cuda/experimental/__async/sender/queries.cuh>
+#  include <cuda/experimental/__async/sender/stop_token.cuh>
+#  include <cuda/experimental/__async/sender/tuple.cuh>
+#  include <cuda/experimental/__async/sender/utility.cuh>
+#  include <cuda/experimental/__async/sender/variant.cuh>
+
+#  include <memory>
+
+#  include <cuda/experimental/__async/sender/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+// Forward-declare the split and ensure_started algorithm tag types:
+struct split_t;
+struct ensure_started_t;
+
+// An operation waiting for the result of a shared operation
+struct __shared_waiter : __immovable
+{
+  using __complete_fn_t = void(__shared_waiter*) noexcept;
+
+  _CUDAX_API explicit __shared_waiter(__complete_fn_t* __complete) noexcept
+      : __complete_fn_{__complete}
+  {}
+
+  __shared_waiter* __next_ = nullptr;
+  __complete_fn_t* __complete_fn_;
+};
+
+// The results of the shared operation are stored decayed, which may throw
+template <class _AlgoTag, class _SetTag>
+struct __shared_decay_args
+{
+  template <class... _Ts>
+  _CUDAX_TRIVIAL_API constexpr auto operator()() const noexcept
+  {
+    if constexpr (!__decay_copyable<_Ts...>)
+    {
+      return invalid_completion_signature<_WHERE(_IN_ALGORITHM, _AlgoTag),
+                                          _WHAT(_ARGUMENTS_ARE_NOT_DECAY_COPYABLE),
+                                          _WITH_ARGUMENTS(_Ts...)>();
+    }
+    else if constexpr (!__nothrow_decay_copyable<_Ts...>)
+    {
+      return completion_signatures<_SetTag(__decay_t<_Ts>...), set_error_t(::std::exception_ptr)>{};
+    }
+    else
+    {
+      return completion_signatures<_SetTag(__decay_t<_Ts>...)>{};
+    }
+  }
+};
+
+// Every consumer of split gets const lvalue references to the results
+template <class _SetTag>
+struct __shared_cref_args
+{
+  template <class... _Ts>
+  _CUDAX_TRIVIAL_API constexpr auto operator()() const noexcept -> completion_signatures<_SetTag(const _Ts&...)>
+  {
+    return {};
+  }
+};
+
+//! The state that the senders returned by split and ensure_started share with
+//! the operations they are connected to. It is reference counted by all of
+//! them and by the shared operation while it runs, and it is allocated in one
+//! piece with the allocator of the environment given to the algorithm.
+//!
+//! Operations waiting for the result are pushed onto a lock-free list. When
+//! the shared operation completes, it swaps the list for a sentinel, so that
+//! operations arriving later complete immediately with the stored result.
+template <class _AlgoTag, class _Sndr, class _Env>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __shared_state
+{
+  struct __env_t
+  {
+    __shared_state* __state_;
+
+    _CUDAX_API auto query(get_stop_token_t) const noexcept -> inplace_stop_token
+    {
+      return __state_->__stop_source_.get_token();
+    }
+
+    template <class _Query>
+    _CUDAX_API auto query(_Query) const noexcept(__nothrow_queryable_with<const _Env&, _Query>)
+      -> __query_result_t<const _Env&, _Query>
+    {
+      return __state_->__env_.query(_Query());
+    }
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CUDAX_API void set_value(_As&&... __as) noexcept
+    {
+      __state_->__complete(set_value_t(), static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CUDAX_API void set_error(_Error&& __error) noexcept
+    {
+      __state_->__complete(set_error_t(), static_cast<_Error&&>(__error));
+    }
+
+    _CUDAX_API void set_stopped() noexcept
+    {
+      __state_->__complete(set_stopped_t());
+    }
+
+    _CUDAX_API auto get_env() const noexcept -> __env_t
+    {
+      return __env_t{__state_};
+    }
+
+    __shared_state* __state_;
+  };
+
+  using __completions_t = decltype(transform_completion_signatures(
+    completion_signatures_of_t<_Sndr, __env_t>(),
+    __shared_decay_args<_AlgoTag, set_value_t>{},
+    __shared_decay_args<_AlgoTag, set_error_t>{}));
+
+  using __results_t = typename __completions_t::template __transform_q<__decayed_tuple, __variant>;
+
+  using __allocator_t =
+    typename ::std::allocator_traits<__decay_t<__call_result_t<get_allocator_t, const _Env&>>>::template rebind_alloc<
+      __shared_state>;
+  using __traits_t = ::std::allocator_traits<__allocator_t>;
+
+  _CUDAX_API __shared_state(_Sndr&& __sndr, _Env&& __env, const __allocator_t& __alloc)
+      : __env_{static_cast<_Env&&>(__env)}
+      , __alloc_{__alloc}
+      , __opstate_{__async::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t{this})}
+  {}
+
+  _CUDAX_IMMOVABLE(__shared_state);
+
+  // Returns a state holding one reference
+  _CUDAX_API static auto __make(_Sndr&& __sndr, _Env&& __env) -> __shared_state*
+  {
+    __allocator_t __alloc{get_allocator(__env)};
+    __shared_state* const __state = __traits_t::allocate(__alloc, 1);
+    _CUDAX_TRY( //
+      ({        //
+        __traits_t::construct(__alloc, __state, static_cast<_Sndr&&>(__sndr), static_cast<_Env&&>(__env), __alloc);
+      }),
+      _CUDAX_CATCH(...) //
+      ({                //
+        __traits_t::deallocate(__alloc, __state, 1);
+        throw;
+      }) //
+    )
+    return __state;
+  }
+
+  _CUDAX_API void __add_ref() noexcept
+  {
+    __refs_.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+  }
+
+  _CUDAX_API void __release() noexcept
+  {
+    if (__refs_.fetch_sub(1, _CUDA_VSTD::memory_order_acq_rel) == 1)
+    {
+      __allocator_t __alloc{static_cast<__allocator_t&&>(__alloc_)};
+      __traits_t::destroy(__alloc, this);
+      __traits_t::deallocate(__alloc, this, 1);
+    }
+  }
+
+  // Starts the shared operation unless it has already been started
+  _CUDAX_API void __start() noexcept
+  {
+    if (!__started_.exchange(true, _CUDA_VSTD::memory_order_relaxed))
+    {
+      // the shared operation holds a reference until it has notified every
+      // waiter, which may destroy the operations that hold the others
+      __add_ref();
+      __async::start(__opstate_);
+    }
+  }
+
+  // Returns false if the shared operation has already completed, in which
+  // case the waiter is not added and the result can be read right away
+  _CUDAX_API bool __add_waiter(__shared_waiter* __waiter) noexcept
+  {
+    void* __head = __waiters_.load(_CUDA_VSTD::memory_order_acquire);
+    do
+    {
+      if (__head == __completed())
+      {
+        return false;
+      }
+      __waiter->__next_ = static_cast<__shared_waiter*>(__head);
+    } while (!__waiters_.compare_exchange_weak(
+      __head, __waiter, _CUDA_VSTD::memory_order_release, _CUDA_VSTD::memory_order_acquire));
+    return true;
+  }
+
+  _CUDAX_API void __request_stop() noexcept
+  {
+    __stop_source_.request_stop();
+  }
+
+  template <class _Tag, class... _As>
+  _CUDAX_API void __complete(_Tag, _As&&... __as) noexcept
+  {
+    using __tupl_t = __tuple<_Tag, __decay_t<_As>...>;
+    if constexpr (__nothrow_decay_copyable<_As...>)
+    {
+      __results_.template __emplace<__tupl_t>(_Tag(), static_cast<_As&&>(__as)...);
+    }
+    else
+    {
+      _CUDAX_TRY( //
+        ({        //
+          __results_.template __emplace<__tupl_t>(_Tag(), static_cast<_As&&>(__as)...);
+        }),
+        _CUDAX_CATCH(...) //
+        ({                //
+          __results_.template __emplace<__tuple<set_error_t, ::std::exception_ptr>>(
+            set_error_t(), ::std::current_exception());
+        }) //
+      )
+    }
+
+    void* const __head = __waiters_.exchange(__completed(), _CUDA_VSTD::memory_order_acq_rel);
+    for (auto* __waiter = static_cast<__shared_waiter*>(__head); __waiter != nullptr;)
+    {
+      // completing a waiter may destroy it
+      __shared_waiter* const __next = __waiter->__next_;
+      __waiter->__complete_fn_(__waiter);
+      __waiter = __next;
+    }
+    __release();
+  }
+
+  _CUDAX_API auto __completed() noexcept -> void*
+  {
+    return this;
+  }
+
+  _Env __env_;
+  __allocator_t __alloc_;
+  // keep the counters of the state off the cache lines of its neighbours
+  alignas(64) _CUDA_VSTD::atomic<size_t> __refs_{1};
+  _CUDA_VSTD::atomic<bool> __started_{false};
+  // nullptr, the head of the list of waiters, or __completed()
+  _CUDA_VSTD::atomic<void*> __waiters_{nullptr};
+  inplace_stop_source __stop_source_{};
+  __results_t __results_{};
+  connect_result_t<_Sndr, __rcvr_t> __opstate_;
+};
+
+template <bool _Eager>
+struct __shared_t
+{
+private:
+  using _AlgoTag = _CUDA_VSTD::conditional_t<_Eager, ensure_started_t, split_t>;
+
+  template <class _Sndr, class _Env>
+  using __state_t = __shared_state<_AlgoTag, _Sndr, _Env>;
+
+  template <class _Rcvr, class _State>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __shared_waiter
+  {
+    using operation_state_concept = operation_state_t;
+    using __results_t             = typename _State::__results_t;
+
+    // Takes over a reference to the state
+    _CUDAX_API __opstate_t(_State* __state, _Rcvr __rcvr) noexcept
+        : __shared_waiter{&__complete_impl}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+        , __state_{__state}
+    {}
+
+    _CUDAX_IMMOVABLE(__opstate_t);
+
+    _CUDAX_API ~__opstate_t()
+    {
+      __state_->__release();
+    }
+
+    _CUDAX_API void start() & noexcept
+    {
+      if (!__state_->__add_waiter(this))
+      {
+        __complete_impl(this);
+      }
+      else if constexpr (!_Eager)
+      {
+        __state_->__start();
+      }
+    }
+
+    _CUDAX_API static void __complete_impl(__shared_waiter* __waiter) noexcept
+    {
+      auto* const __self = static_cast<__opstate_t*>(__waiter);
+      if constexpr (_Eager)
+      {
+        // the only consumer takes the result
+        __results_t::__visit(__visit_fn{}, static_cast<__results_t&&>(__self->__state_->__results_), __self->__rcvr_);
+      }
+      else
+      {
+        const __results_t& __results = __self->__state_->__results_;
+        __results_t::__visit(__visit_fn{}, __results, __self->__rcvr_);
+      }
+    }
+
+    struct __complete_fn
+    {
+      template <class _Tag, class... _As>
+      _CUDAX_API void operator()(_Rcvr& __rcvr, _Tag, _As&&... __as) const noexcept
+      {
+        _Tag()(static_cast<_Rcvr&&>(__rcvr), static_cast<_As&&>(__as)...);
+      }
+    };
+
+    struct __visit_fn
+    {
+      template <class _Tupl>
+      _CUDAX_API void operator()(_Rcvr& __rcvr, _Tupl&& __tupl) const noexcept
+      {
+        __tupl.__apply(__complete_fn{}, static_cast<_Tupl&&>(__tupl), __rcvr);
+      }
+    };
+
+    _Rcvr __rcvr_;
+    _State* __state_;
+  };
+
+public:
+  template <class _Sndr, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t;
+
+  template <class _Sndr, class _Env = env<>>
+  _CUDAX_API auto operator()(_Sndr __sndr, _Env __env = {}) const -> __sndr_t<_Sndr, _Env>;
+
+  _CUDAX_TRIVIAL_API auto operator()() const noexcept -> __closure_t;
+};
+
+// Makes the senders of ensure_started move-only
+struct __move_only
+{
+  _CUDAX_DEFAULTED_API __move_only() = default;
+  _CUDAX_DEFAULTED_API __move_only(__move_only&&) = default;
+  __move_only(const __move_only&) = delete;
+};
+
+template <bool _Eager>
+template <class _Sndr, class _Env>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __shared_t<_Eager>::__sndr_t
+    : _CUDA_VSTD::conditional_t<_Eager, __move_only, __nil>
+{
+  using sender_concept = sender_t;
+  using __state_t      = __shared_t::__state_t<_Sndr, _Env>;
+
+  // Holds a reference to the shared state
+  struct __state_ref_t
+  {
+    _CUDAX_API explicit __state_ref_t(__state_t* __state) noexcept
+        : __ptr_{__state}
+    {}
+
+    _CUDAX_API __state_ref_t(__state_ref_t&& __other) noexcept
+        : __ptr_{_CUDA_VSTD::exchange(__other.__ptr_, nullptr)}
+    {}
+
+    _CUDAX_API __state_ref_t(const __state_ref_t& __other) noexcept
+        : __ptr_{__other.__ptr_}
+    {
+      if (__ptr_ != nullptr)
+      {
+        __ptr_->__add_ref();
+      }
+    }
+
+    __state_ref_t& operator=(const __state_ref_t&) = delete;
+
+    _CUDAX_API ~__state_ref_t()
+    {
+      if (__ptr_ != nullptr)
+      {
+        if constexpr (_Eager)
+        {
+          // nobody will ever consume the result of the eagerly started work
+          __ptr_->__request_stop();
+        }
+        __ptr_->__release();
+      }
+    }
+
+    __state_t* __ptr_;
+  };
+
+  _CUDAX_API explicit __sndr_t(__state_t* __state) noexcept
+      : __state_{__state}
+  {}
+
+  template <class _Self, class... _OtherEnv>
+  _CUDAX_API static constexpr auto get_completion_signatures()
+  {
+    if constexpr (_Eager)
+    {
+      return typename __state_t::__completions_t();
+    }
+    else
+    {
+      return transform_completion_signatures(typename __state_t::__completions_t(),
+                                             __shared_cref_args<set_value_t>{},
+                                             __shared_cref_args<set_error_t>{});
+    }
+  }
+
+  template <class _Rcvr>
+  _CUDAX_API auto connect(_Rcvr __rcvr) && noexcept -> __opstate_t<_Rcvr, __state_t>
+  {
+    return __opstate_t<_Rcvr, __state_t>{_CUDA_VSTD::exchange(__state_.__ptr_, nullptr), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  template <class _Rcvr, bool _Copyable = !_Eager, _CUDA_VSTD::enable_if_t<_Copyable, int> = 0>
+  _CUDAX_API auto connect(_Rcvr __rcvr) const& noexcept -> __opstate_t<_Rcvr, __state_t>
+  {
+    __state_.__ptr_->__add_ref();
+    return __opstate_t<_Rcvr, __state_t>{__state_.__ptr_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+private:
+  __state_ref_t __state_;
+};
+
+template <bool _Eager>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __shared_t<_Eager>::__closure_t
+{
+  template <class _Sndr>
+  _CUDAX_TRIVIAL_API friend auto operator|(_Sndr __sndr, __closure_t) //
+    -> __call_result_t<_AlgoTag, _Sndr>
+  {
+    return _AlgoTag()(static_cast<_Sndr&&>(__sndr));
+  }
+};
+
+template <bool _Eager>
+template <class _Sndr, class _Env>
+_CUDAX_API auto __shared_t<_Eager>::operator()(_Sndr __sndr, _Env __env) const -> __sndr_t<_Sndr, _Env>
+{
+  using __state_t = __shared_t::__state_t<_Sndr, _Env>;
+  static_assert(__valid_completion_signatures<completion_signatures_of_t<_Sndr, typename __state_t::__env_t>>);
+
+  __state_t* const __state = __state_t::__make(static_cast<_Sndr&&>(__sndr), static_cast<_Env&&>(__env));
+  if constexpr (_Eager)
+  {
+    __state->__start();
+  }
+  return __sndr_t<_Sndr, _Env>{__state};
+}
+
+template <bool _Eager>
+_CUDAX_TRIVIAL_API auto __shared_t<_Eager>::operator()() const noexcept -> __closure_t
+{
+  return __closure_t{};
+}
+
+//! split(sndr, env = {}) returns a copyable sender that starts sndr when the
+//! first operation it is connected to starts, and completes every one of them
+//! with const references to the results of sndr.
+_CCCL_GLOBAL_CONSTANT struct split_t : __shared_t<false>
+{
+} split{};
+
+//! ensure_started(sndr, env = {}) starts sndr right away, and returns a
+//! move-only sender that completes with the results of sndr. Destroying the
+//! sender without connecting it requests sndr to stop.
+_CCCL_GLOBAL_CONSTANT struct ensure_started_t : __shared_t<true>
+{
+} ensure_started{};
+} // namespace cuda::experimental::__async
+
+#  include <cuda/experimental/__async/sender/epilogue.cuh>
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
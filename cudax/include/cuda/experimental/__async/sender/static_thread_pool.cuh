@@ -0,0 +1,589 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+#define __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/experimental/__detail/config.cuh>
+
+// The workers of the pool are host threads
+#if !defined(__CUDA_ARCH__)
+
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/experimental/__async/sender/completion_signatures.cuh>
+#  include <cuda/experimental/__async/sender/cpos.cuh>
+#  include <cuda/experimental/__async/sender/env.cuh>
+#  include <cuda/experimental/__async/sender/queries.cuh>
+#  include <cuda/experimental/__async/sender/stop_token.cuh>
+#  include <cuda/experimental/__async/sender/utility.cuh>
+
+#  include <atomic>
+#  include <memory>
+#  include <mutex>
+#  include <new>
+#  include <thread>
+
+#  include <cuda/experimental/__async/sender/prologue.cuh>
+
+namespace cuda::experimental::__async
+{
+class static_thread_pool;
+
+struct __pool_task : __immovable
+{
+  using __execute_fn_t = void(__pool_task*) noexcept;
+
+  _CUDAX_API explicit __pool_task(__execute_fn_t* __execute) noexcept
+      : __execute_fn_{__execute}
+  {}
+
+  __pool_task* __next_ = nullptr;
+  __execute_fn_t* __execute_fn_;
+
+  _CUDAX_API void __execute() noexcept
+  {
+    (*__execute_fn_)(this);
+  }
+};
+
+// A bounded Chase-Lev deque of tasks, in the formulation for weak memory
+// models by Lê et al. Its owner pushes and pops tasks at the bottom, while
+// other workers steal them from the top.
+class __work_stealing_deque
+{
+  static constexpr ::std::int64_t __capacity = 1024;
+
+  alignas(64) ::std::atomic<::std::int64_t> __top_{0};
+  alignas(64) ::std::atomic<::std::int64_t> __bottom_{0};
+  alignas(64) ::std::atomic<__pool_task*> __tasks_[__capacity]{};
+
+  _CUDAX_API auto __slot(::std::int64_t __index) noexcept -> ::std::atomic<__pool_task*>&
+  {
+    return __tasks_[__index & (__capacity - 1)];
+  }
+
+public:
+  // Returns false if the deque is full
+  _CUDAX_API bool __push(__pool_task* __task) noexcept
+  {
+    ::std::int64_t const __bottom = __bottom_.load(::std::memory_order_relaxed);
+    ::std::int64_t const __top    = __top_.load(::std::memory_order_acquire);
+    if (__bottom - __top >= __capacity)
+    {
+      return false;
+    }
+    __slot(__bottom).store(__task, ::std::memory_order_relaxed);
+    ::std::atomic_thread_fence(::std::memory_order_release);
+    __bottom_.store(__bottom + 1, ::std::memory_order_relaxed);
+    return true;
+  }
+
+  _CUDAX_API auto __pop() noexcept -> __pool_task*
+  {
+    ::std::int64_t const __bottom = __bottom_.load(::std::memory_order_relaxed) - 1;
+    __bottom_.store(__bottom, ::std::memory_order_relaxed);
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    ::std::int64_t __top = __top_.load(::std::memory_order_relaxed);
+
+    if (__bottom < __top)
+    {
+      __bottom_.store(__bottom + 1, ::std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    __pool_task* __task = __slot(__bottom).load(::std::memory_order_relaxed);
+    if (__top == __bottom)
+    {
+      // the last task may be stolen concurrently
+      if (!__top_.compare_exchange_strong(
+            __top, __top + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+      {
+        __task = nullptr;
+      }
+      __bottom_.store(__bottom + 1, ::std::memory_order_relaxed);
+    }
+    return __task;
+  }
+
+  _CUDAX_API auto __steal() noexcept -> __pool_task*
+  {
+    ::std::int64_t __top = __top_.load(::std::memory_order_acquire);
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    ::std::int64_t const __bottom = __bottom_.load(::std::memory_order_acquire);
+
+    if (__top >= __bottom)
+    {
+      return nullptr;
+    }
+
+    __pool_task* const __task = __slot(__top).load(::std::memory_order_relaxed);
+    if (!__top_.compare_exchange_strong(__top, __top + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return __task;
+  }
+};
+
+template <class _Rcvr>
+struct __pool_operation : __pool_task
+{
+  static_thread_pool* __pool_;
+  _CCCL_NO_UNIQUE_ADDRESS _Rcvr __rcvr_;
+
+  _CUDAX_API static void __execute_impl(__pool_task* __p) noexcept
+  {
+    auto& __rcvr = static_cast<__pool_operation*>(__p)->__rcvr_;
+    if (get_stop_token(get_env(__rcvr)).stop_requested())
+    {
+      set_stopped(static_cast<_Rcvr&&>(__rcvr));
+    }
+    else
+    {
+      set_value(static_cast<_Rcvr&&>(__rcvr));
+    }
+  }
+
+  _CUDAX_API __pool_operation(static_thread_pool* __pool, _Rcvr __rcvr)
+      : __pool_task{&__execute_impl}
+      , __pool_{__pool}
+      , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+  {}
+
+  _CUDAX_API void start() & noexcept;
+};
+
+// A bulk operation on a static_thread_pool, partitioned into a chunk per
+// worker. The last chunk to finish frees the state and completes the
+// operation.
+template <class _Op, class _Shape>
+struct __pool_bulk_state
+{
+  struct __chunk : __pool_task
+  {
+    _CUDAX_API __chunk() noexcept
+        : __pool_task{&__execute_impl}
+    {}
+
+    _CUDAX_API static void __execute_impl(__pool_task* __p) noexcept
+    {
+      auto* __self = static_cast<__chunk*>(__p);
+      __self->__state_->__run(__self->__begin_, __self->__end_);
+    }
+
+    __pool_bulk_state* __state_;
+    _Shape __begin_;
+    _Shape __end_;
+  };
+
+  _CUDAX_API __pool_bulk_state(_Op& __op, ::std::uint32_t __num_chunks) noexcept
+      : __op_{__op}
+      , __remaining_{__num_chunks}
+      , __chunks_{new (::std::nothrow) __chunk[__num_chunks]}
+  {}
+
+  _CUDAX_API void __run(_Shape __begin, _Shape __end) noexcept
+  {
+    __op_.__execute(__begin, __end);
+    if (__remaining_.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+    {
+      _Op& __op = __op_;
+      delete this;
+      __op.__complete();
+    }
+  }
+
+  _Op& __op_;
+  ::std::atomic<::std::uint32_t> __remaining_;
+  ::std::unique_ptr<__chunk[]> __chunks_;
+};
+
+//! A fixed set of host threads that run the work scheduled on them. Every
+//! worker has a deque of tasks of its own, where the work that it schedules
+//! goes. Work scheduled from other threads goes to a shared queue. A worker
+//! that runs out of work steals the oldest task of a randomly chosen worker,
+//! and parks when there is no work left anywhere.
+class _CCCL_TYPE_VISIBILITY_DEFAULT static_thread_pool
+{
+  template <class>
+  friend struct __pool_operation;
+
+  struct alignas(64) __worker
+  {
+    __work_stealing_deque __deque_;
+    ::std::uint64_t __seed_;
+  };
+
+  // The worker the calling thread is, if it belongs to a pool
+  struct __worker_ref
+  {
+    static_thread_pool* __pool_;
+    ::std::uint32_t __index_;
+  };
+
+  static _CUDAX_API auto __this_worker() noexcept -> __worker_ref&
+  {
+    static thread_local __worker_ref __ref{nullptr, 0};
+    return __ref;
+  }
+
+public:
+  class __scheduler
+  {
+    struct __schedule_task
+    {
+      using __t            = __schedule_task;
+      using __id           = __schedule_task;
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      _CUDAX_API auto connect(_Rcvr __rcvr) const noexcept -> __pool_operation<_Rcvr>
+      {
+        return {__pool_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      _CUDAX_API static constexpr auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>();
+      }
+
+      struct __env
+      {
+        static_thread_pool* __pool_;
+
+        template <class _Tag>
+        _CUDAX_API auto query(get_completion_scheduler_t<_Tag>) const noexcept -> __scheduler
+        {
+          return __pool_->get_scheduler();
+        }
+      };
+
+      _CUDAX_API auto get_env() const noexcept -> __env
+      {
+        return __env{__pool_};
+      }
+
+    private:
+      friend __scheduler;
+
+      _CUDAX_API explicit __schedule_task(static_thread_pool* __pool) noexcept
+          : __pool_(__pool)
+      {}
+
+      static_thread_pool* const __pool_;
+    };
+
+    friend static_thread_pool;
+
+    _CUDAX_API explicit __scheduler(static_thread_pool* __pool) noexcept
+        : __pool_(__pool)
+    {}
+
+    static_thread_pool* __pool_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] _CUDAX_API auto schedule() const noexcept -> __schedule_task
+    {
+      return __schedule_task{__pool_};
+    }
+
+    _CUDAX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    // Partitions a bulk operation across the workers of the pool
+    template <class _Op, class _Shape>
+    _CUDAX_API void __bulk_execute(_Op& __op, _Shape __shape) const noexcept
+    {
+      __pool_->__bulk_execute(__op, __shape);
+    }
+
+    _CUDAX_API friend bool operator==(const __scheduler& __a, const __scheduler& __b) noexcept
+    {
+      return __a.__pool_ == __b.__pool_;
+    }
+
+    _CUDAX_API friend bool operator!=(const __scheduler& __a, const __scheduler& __b) noexcept
+    {
+      return __a.__pool_ != __b.__pool_;
+    }
+  };
+
+  explicit static_thread_pool(::std::uint32_t __num_threads = ::std::thread::hardware_concurrency());
+
+  ~static_thread_pool();
+
+  static_thread_pool(const static_thread_pool&)            = delete;
+  static_thread_pool& operator=(const static_thread_pool&) = delete;
+
+  _CUDAX_API auto get_scheduler() noexcept -> __scheduler
+  {
+    return __scheduler{this};
+  }
+
+  _CUDAX_API auto available_parallelism() const noexcept -> ::std::uint32_t
+  {
+    return __num_threads_;
+  }
+
+private:
+  template <class _Op, class _Shape>
+  void __bulk_execute(_Op& __op, _Shape __shape) noexcept;
+
+  void __run(::std::uint32_t __index) noexcept;
+  void __enqueue(__pool_task* __task) noexcept;
+  auto __next_task(::std::uint32_t __index) noexcept -> __pool_task*;
+  auto __pop_shared() noexcept -> __pool_task*;
+  void __notify() noexcept;
+
+  ::std::uint32_t __num_threads_;
+  ::std::unique_ptr<__worker[]> __workers_;
+  ::std::unique_ptr<::std::thread[]> __threads_;
+
+  // work scheduled from outside the pool, or that did not fit in a deque
+  ::std::mutex __shared_mutex_{};
+  __pool_task* __shared_head_ = nullptr;
+  __pool_task* __shared_tail_ = nullptr;
+  ::std::atomic<bool> __shared_empty_{true};
+
+  // A worker that finds no work registers as a sleeper, reads the epoch,
+  // looks for work once more, and waits for the epoch to change. Scheduling
+  // advances the epoch if there are sleepers.
+  alignas(64) ::std::atomic<::std::uint32_t> __sleepers_{0};
+  alignas(64) ::cuda::std::atomic<::std::uint32_t> __epoch_{0};
+  ::std::atomic<bool> __stop_{false};
+};
+
+template <class _Rcvr>
+_CUDAX_API inline void __pool_operation<_Rcvr>::start() & noexcept
+{
+  __pool_->__enqueue(this);
+}
+
+inline static_thread_pool::static_thread_pool(::std::uint32_t __num_threads)
+    : __num_threads_(__num_threads == 0 ? 1 : __num_threads)
+    , __workers_(new __worker[__num_threads_])
+    , __threads_(new ::std::thread[__num_threads_])
+{
+  for (::std::uint32_t __i = 0; __i < __num_threads_; ++__i)
+  {
+    __workers_[__i].__seed_ = 0x9E3779B97F4A7C15ull * (__i + 1);
+  }
+  for (::std::uint32_t __i = 0; __i < __num_threads_; ++__i)
+  {
+    __threads_[__i] = ::std::thread([this, __i] {
+      __run(__i);
+    });
+  }
+}
+
+inline static_thread_pool::~static_thread_pool()
+{
+  __stop_.store(true, ::std::memory_order_seq_cst);
+  __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+  __epoch_.notify_all();
+  for (::std::uint32_t __i = 0; __i < __num_threads_; ++__i)
+  {
+    __threads_[__i].join();
+  }
+}
+
+inline void static_thread_pool::__enqueue(__pool_task* __task) noexcept
+{
+  __worker_ref const& __self = __this_worker();
+  if (__self.__pool_ != this || !__workers_[__self.__index_].__deque_.__push(__task))
+  {
+    ::std::lock_guard<::std::mutex> __lock{__shared_mutex_};
+    __task->__next_ = nullptr;
+    if (__shared_tail_ == nullptr)
+    {
+      __shared_head_ = __task;
+    }
+    else
+    {
+      __shared_tail_->__next_ = __task;
+    }
+    __shared_tail_ = __task;
+    __shared_empty_.store(false, ::std::memory_order_relaxed);
+  }
+  __notify();
+}
+
+template <class _Op, class _Shape>
+void static_thread_pool::__bulk_execute(_Op& __op, _Shape __shape) noexcept
+{
+  ::std::uint32_t __num_chunks = __num_threads_;
+  if (!(_Shape(0) < __shape))
+  {
+    __num_chunks = 0;
+  }
+  else if (static_cast<::std::uint64_t>(__shape) < __num_threads_)
+  {
+    __num_chunks = static_cast<::std::uint32_t>(__shape);
+  }
+
+  using __state_t          = __pool_bulk_state<_Op, _Shape>;
+  __state_t* const __state = __num_chunks > 1 ? new (::std::nothrow) __state_t{__op, __num_chunks} : nullptr;
+  if (__state == nullptr || __state->__chunks_ == nullptr)
+  {
+    // a single chunk, or no memory to partition the shape: run it inline
+    delete __state;
+    if (__num_chunks != 0)
+    {
+      __op.__execute(_Shape(0), __shape);
+    }
+    __op.__complete();
+    return;
+  }
+
+  // chunk i is [i * q + min(i, r), (i + 1) * q + min(i + 1, r))
+  _Shape const __quotient  = __shape / static_cast<_Shape>(__num_chunks);
+  _Shape const __remainder = __shape % static_cast<_Shape>(__num_chunks);
+  _Shape __begin           = 0;
+  for (::std::uint32_t __i = 0; __i < __num_chunks; ++__i)
+  {
+    auto& __chunk    = __state->__chunks_[__i];
+    __chunk.__state_ = __state;
+    __chunk.__begin_ = __begin;
+    __begin += __quotient + (static_cast<_Shape>(__i) < __remainder ? 1 : 0);
+    __chunk.__end_ = __begin;
+  }
+
+  // a worker runs the first chunk itself instead of scheduling it
+  bool const __on_worker = __this_worker().__pool_ == this;
+  for (::std::uint32_t __i = __on_worker ? 1 : 0; __i < __num_chunks; ++__i)
+  {
+    __enqueue(&__state->__chunks_[__i]);
+  }
+  if (__on_worker)
+  {
+    __state->__chunks_[0].__execute();
+  }
+}
+
+inline void static_thread_pool::__notify() noexcept
+{
+  // pairs with the fence of a worker that registers as a sleeper, so that
+  // either the worker sees the new task or this sees the sleeper
+  ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+  if (__sleepers_.load(::std::memory_order_relaxed) != 0)
+  {
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+    __epoch_.notify_one();
+  }
+}
+
+inline auto static_thread_pool::__pop_shared() noexcept -> __pool_task*
+{
+  if (__shared_empty_.load(::std::memory_order_relaxed))
+  {
+    return nullptr;
+  }
+  ::std::lock_guard<::std::mutex> __lock{__shared_mutex_};
+  __pool_task* const __task = __shared_head_;
+  if (__task != nullptr)
+  {
+    __shared_head_ = __task->__next_;
+    if (__shared_head_ == nullptr)
+    {
+      __shared_tail_ = nullptr;
+      __shared_empty_.store(true, ::std::memory_order_relaxed);
+    }
+  }
+  return __task;
+}
+
+inline auto static_thread_pool::__next_task(::std::uint32_t __index) noexcept -> __pool_task*
+{
+  __worker& __self = __workers_[__index];
+  if (__pool_task* __task = __self.__deque_.__pop())
+  {
+    return __task;
+  }
+  if (__pool_task* __task = __pop_shared())
+  {
+    return __task;
+  }
+
+  // visit the other workers once, starting from a random one
+  __self.__seed_ ^= __self.__seed_ << 13;
+  __self.__seed_ ^= __self.__seed_ >> 7;
+  __self.__seed_ ^= __self.__seed_ << 17;
+  ::std::uint32_t __victim = static_cast<::std::uint32_t>(__self.__seed_ % __num_threads_);
+  for (::std::uint32_t __i = 0; __i < __num_threads_; ++__i, __victim = (__victim + 1) % __num_threads_)
+  {
+    if (__victim == __index)
+    {
+      continue;
+    }
+    if (__pool_task* __task = __workers_[__victim].__deque_.__steal())
+    {
+      return __task;
+    }
+  }
+  return nullptr;
+}
+
+inline void static_thread_pool::__run(::std::uint32_t __index) noexcept
+{
+  __this_worker() = __worker_ref{this, __index};
+  for (;;)
+  {
+    __pool_task* __task = __next_task(__index);
+    if (__task == nullptr)
+    {
+      __sleepers_.fetch_add(1, ::std::memory_order_relaxed);
+      ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+      ::std::uint32_t const __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+      __task                        = __next_task(__index);
+      if (__task == nullptr && !__stop_.load(::std::memory_order_seq_cst))
+      {
+        __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+      }
+      __sleepers_.fetch_sub(1, ::std::memory_order_relaxed);
+      if (__task == nullptr)
+      {
+        // work scheduled before the pool is destroyed still runs
+        if (__stop_.load(::std::memory_order_seq_cst) && (__task = __next_task(__index)) == nullptr)
+        {
+          return;
+        }
+        if (__task == nullptr)
+        {
+          continue;
+        }
+      }
+    }
+    __task->__execute();
+  }
+}
+} // namespace cuda::experimental::__async
+
+#  include <cuda/experimental/__async/sender/epilogue.cuh>
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -62,6 +62,10 @@ private:
     }
   };
 
+  // The values are decayed so that they outlive the operation that sent them
+  template <class... _Ts>
+  using __decayed_std_tuple = _CUDA_VSTD::tuple<__decay_t<_Ts>...>;
+
   template <class _Values>
   struct __state_t
   {
@@ -169,7 +173,7 @@ public:
     }
     else
     {
-      using __values = __value_types<__completions, _CUDA_VSTD::tuple, _CUDA_VSTD::__type_self_t>;
+      using __values = __value_types<__completions, __decayed_std_tuple, _CUDA_VSTD::__type_self_t>;
       _CUDA_VSTD::optional<__values> __result{};
       __state_t<__values> __state{&__result, {}, {}};
 
@@ -90,6 +90,11 @@ public:
     return __storage_;
   }
 
+  _CUDAX_TRIVIAL_API const void* __ptr() const noexcept
+  {
+    return __storage_;
+  }
+
   _CUDAX_TRIVIAL_API size_t __index() const noexcept
   {
     return __index_;
@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/checked_receiver.cuh"
+#include "common/error_scheduler.cuh"
+#include "common/stopped_scheduler.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+namespace
+{
+TEST_CASE("bulk calls the function for every index of the shape", "[bulk]")
+{
+  int sum  = 0;
+  auto snd = cudax_async::just(10) | cudax_async::bulk(4, [&sum](int i, int& x) {
+               sum += i + x;
+             });
+  auto op  = cudax_async::connect(std::move(snd), checked_value_receiver{10});
+  cudax_async::start(op);
+  CUDAX_CHECK(sum == 0 + 1 + 2 + 3 + 4 * 10);
+}
+
+TEST_CASE("bulk_chunked covers the whole shape", "[bulk]")
+{
+  int covered = 0;
+  auto snd    = cudax_async::just() | cudax_async::bulk_chunked(100, [&covered](int begin, int end) {
+               covered += end - begin;
+             });
+  auto op     = cudax_async::connect(std::move(snd), checked_value_receiver<>{});
+  cudax_async::start(op);
+  CUDAX_CHECK(covered == 100);
+}
+
+TEST_CASE("bulk treats a shape that is not positive as empty", "[bulk]")
+{
+  auto fn = [](int) {
+    CUDAX_FAIL("the function should not be called");
+  };
+  auto chunked_fn = [](int, int) {
+    CUDAX_FAIL("the function should not be called");
+  };
+
+  auto op1 = cudax_async::connect(cudax_async::just() | cudax_async::bulk(0, fn), checked_value_receiver<>{});
+  cudax_async::start(op1);
+
+  auto op2 = cudax_async::connect(cudax_async::just() | cudax_async::bulk(-3, fn), checked_value_receiver<>{});
+  cudax_async::start(op2);
+
+  auto op3 = cudax_async::connect(cudax_async::just() | cudax_async::bulk_chunked(0, chunked_fn),
+                                  checked_value_receiver<>{});
+  cudax_async::start(op3);
+
+  auto op4 = cudax_async::connect(cudax_async::just() | cudax_async::bulk_chunked(-3, chunked_fn),
+                                  checked_value_receiver<>{});
+  cudax_async::start(op4);
+}
+
+TEST_CASE("bulk passes errors and stopped through", "[bulk]")
+{
+  auto fn = [](int) {
+    CUDAX_FAIL("the function should not be called");
+  };
+
+  auto snd1 = cudax_async::just() | cudax_async::continue_on(error_scheduler{42}) | cudax_async::bulk(4, fn);
+  auto op1  = cudax_async::connect(std::move(snd1), checked_error_receiver{42});
+  cudax_async::start(op1);
+
+  auto snd2 = cudax_async::just() | cudax_async::continue_on(stopped_scheduler{}) | cudax_async::bulk(4, fn);
+  auto op2  = cudax_async::connect(std::move(snd2), checked_stopped_receiver{});
+  cudax_async::start(op2);
+}
+
+#if !defined(__CUDA_ARCH__)
+
+TEST_CASE("bulk runs serially on the run_loop of sync_wait", "[bulk]")
+{
+  std::vector<std::thread::id> ids;
+  auto snd = cudax_async::just(3) | cudax_async::bulk(8, [&ids](int, int) {
+               ids.push_back(std::this_thread::get_id());
+             });
+  check_values(std::move(snd), 3);
+  CUDAX_REQUIRE(ids.size() == 8);
+  for (auto id : ids)
+  {
+    CUDAX_CHECK(id == std::this_thread::get_id());
+  }
+}
+
+TEST_CASE("bulk is partitioned across the workers of a static_thread_pool", "[bulk]")
+{
+  cudax_async::static_thread_pool pool{4};
+  std::vector<int> hits(1000);
+  std::atomic<int> chunks{0};
+
+  auto snd = cudax_async::schedule(pool.get_scheduler()) | cudax_async::then([] {
+               return 7;
+             })
+           | cudax_async::bulk_chunked(static_cast<int>(hits.size()), [&](int begin, int end, int& x) {
+               chunks.fetch_add(1);
+               for (int i = begin; i < end; ++i)
+               {
+                 hits[i] += x;
+               }
+             });
+  check_values(std::move(snd), 7);
+  CUDAX_CHECK(chunks.load() == 4);
+  for (int hit : hits)
+  {
+    CUDAX_CHECK(hit == 7);
+  }
+}
+
+TEST_CASE("bulk on a static_thread_pool completes once on a pool thread", "[bulk]")
+{
+  cudax_async::static_thread_pool pool{3};
+  std::atomic<int> count{0};
+
+  auto snd = cudax_async::start_on(pool.get_scheduler(),
+                                   cudax_async::just(2) | cudax_async::bulk(10, [&count](int, int x) {
+                                     count.fetch_add(x);
+                                   }))
+           | cudax_async::then([](int x) {
+               return std::make_pair(x, std::this_thread::get_id());
+             });
+  auto [result] = cudax_async::sync_wait(std::move(snd)).value();
+  CUDAX_CHECK(result.first == 2);
+  CUDAX_CHECK(result.second != std::this_thread::get_id());
+  CUDAX_CHECK(count.load() == 20);
+}
+
+TEST_CASE("bulk reports an exception thrown by the function", "[bulk]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto snd = cudax_async::schedule(pool.get_scheduler()) | cudax_async::bulk(16, [](int i) {
+               if (i == 5)
+               {
+                 throw std::runtime_error("bulk");
+               }
+             });
+  CHECK_THROWS_AS(cudax_async::sync_wait(std::move(snd)), std::runtime_error);
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <thread>
+#include <vector>
+
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+namespace
+{
+#if !defined(__CUDA_ARCH__)
+
+TEST_CASE("run_loop runs tasks in the order in which they are scheduled", "[run_loop]")
+{
+  cudax_async::run_loop loop;
+  std::vector<int> order;
+  for (int i = 0; i < 10; ++i)
+  {
+    cudax_async::start_detached(cudax_async::schedule(loop.get_scheduler()) | cudax_async::then([&order, i] {
+                                  order.push_back(i);
+                                }));
+  }
+  loop.finish();
+  loop.run();
+  CUDAX_REQUIRE(order.size() == 10);
+  for (int i = 0; i < 10; ++i)
+  {
+    CUDAX_CHECK(order[i] == i);
+  }
+}
+
+TEST_CASE("run_loop runs the tasks that tasks schedule before finishing", "[run_loop]")
+{
+  cudax_async::run_loop loop;
+  int count = 0;
+  cudax_async::start_detached(cudax_async::schedule(loop.get_scheduler()) | cudax_async::then([&] {
+                                ++count;
+                                cudax_async::start_detached(
+                                  cudax_async::schedule(loop.get_scheduler()) | cudax_async::then([&] {
+                                    ++count;
+                                  }));
+                                loop.finish();
+                              }));
+  loop.run();
+  CUDAX_CHECK(count == 2);
+}
+
+TEST_CASE("run_loop accepts tasks from many threads", "[run_loop]")
+{
+  constexpr int producers = 4;
+  constexpr int tasks     = 1000;
+
+  cudax_async::run_loop loop;
+  int count = 0;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < tasks; ++i)
+      {
+        cudax_async::start_detached(cudax_async::schedule(loop.get_scheduler()) | cudax_async::then([&count] {
+                                      ++count;
+                                    }));
+      }
+    });
+  }
+  std::thread consumer([&] {
+    loop.run();
+  });
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  loop.finish();
+  consumer.join();
+  CUDAX_CHECK(count == producers * tasks);
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,162 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/checked_receiver.cuh"
+#include "common/error_scheduler.cuh"
+#include "common/stopped_scheduler.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+namespace
+{
+#if !defined(__CUDA_ARCH__)
+
+// Counts the allocations it makes
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  int* count;
+
+  counting_allocator(int* c) noexcept
+      : count(c)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : count(other.count)
+  {}
+
+  T* allocate(size_t n)
+  {
+    ++*count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) noexcept
+  {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const counting_allocator<U>& other) const noexcept
+  {
+    return count == other.count;
+  }
+
+  template <class U>
+  bool operator!=(const counting_allocator<U>& other) const noexcept
+  {
+    return count != other.count;
+  }
+};
+
+TEST_CASE("split runs the child once for all of its consumers", "[split]")
+{
+  int count = 0;
+  auto sndr = cudax_async::just(42) | cudax_async::then([&count](int x) {
+                ++count;
+                return x;
+              })
+            | cudax_async::split();
+
+  auto op1 = cudax_async::connect(sndr, checked_value_receiver{42});
+  auto op2 = cudax_async::connect(sndr, checked_value_receiver{42});
+  CUDAX_CHECK(count == 0);
+  cudax_async::start(op1);
+  CUDAX_CHECK(count == 1);
+  cudax_async::start(op2);
+  CUDAX_CHECK(count == 1);
+
+  check_values(std::move(sndr), 42);
+  CUDAX_CHECK(count == 1);
+}
+
+TEST_CASE("ensure_started starts the child right away", "[split]")
+{
+  int count = 0;
+  auto sndr = cudax_async::ensure_started(cudax_async::just(42) | cudax_async::then([&count](int x) {
+                                            ++count;
+                                            return x;
+                                          }));
+  static_assert(!std::is_copy_constructible_v<decltype(sndr)>);
+  CUDAX_CHECK(count == 1);
+  check_values(std::move(sndr), 42);
+  CUDAX_CHECK(count == 1);
+}
+
+TEST_CASE("split and ensure_started pass errors and stopped through", "[split]")
+{
+  auto sndr1 = cudax_async::just() | cudax_async::continue_on(error_scheduler{42}) | cudax_async::split();
+  auto op1   = cudax_async::connect(sndr1, checked_error_receiver{42});
+  cudax_async::start(op1);
+
+  auto sndr2 = cudax_async::ensure_started(cudax_async::just() | cudax_async::continue_on(stopped_scheduler{}));
+  auto op2   = cudax_async::connect(std::move(sndr2), checked_stopped_receiver{});
+  cudax_async::start(op2);
+
+  auto sndr3 = cudax_async::just(1) | cudax_async::then([](int) -> int {
+                 throw std::runtime_error("split");
+               })
+             | cudax_async::split();
+  CHECK_THROWS_AS(cudax_async::sync_wait(sndr3), std::runtime_error);
+  CHECK_THROWS_AS(cudax_async::sync_wait(std::move(sndr3)), std::runtime_error);
+}
+
+TEST_CASE("split fans one stage out to several stages on a static_thread_pool", "[split]")
+{
+  cudax_async::static_thread_pool pool{4};
+  std::atomic<int> count{0};
+
+  auto stage = cudax_async::schedule(pool.get_scheduler()) | cudax_async::then([&count] {
+                 count.fetch_add(1);
+                 return 10;
+               })
+             | cudax_async::split();
+
+  auto sndr = cudax_async::when_all(
+    stage | cudax_async::then([](int x) {
+      return x + 1;
+    }),
+    stage | cudax_async::then([](int x) {
+      return x + 2;
+    }),
+    stage | cudax_async::continue_on(pool.get_scheduler()) | cudax_async::then([](int x) {
+      return x + 3;
+    }));
+  check_values(std::move(sndr), 11, 12, 13);
+  CUDAX_CHECK(count.load() == 1);
+}
+
+TEST_CASE("split allocates its state with the allocator of the environment", "[split]")
+{
+  int allocations = 0;
+  auto env        = cudax_async::prop{cudax_async::get_allocator, counting_allocator<int>{&allocations}};
+
+  auto sndr = cudax_async::split(cudax_async::just(42), env);
+  CUDAX_CHECK(allocations == 1);
+  check_values(sndr, 42);
+  check_values(std::move(sndr), 42);
+  CUDAX_CHECK(allocations == 1);
+
+  check_values(cudax_async::ensure_started(cudax_async::just(42), env), 42);
+  CUDAX_CHECK(allocations == 2);
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/__async/sender.cuh>
+
+#include <atomic>
+#include <thread>
+
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+namespace
+{
+#if !defined(__CUDA_ARCH__)
+
+TEST_CASE("static_thread_pool scheduler models the scheduler concept", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  STATIC_REQUIRE(cudax_async::__is_scheduler<decltype(sched)>);
+  CUDAX_CHECK(sched == pool.get_scheduler());
+  CUDAX_CHECK(cudax_async::get_completion_scheduler<cudax_async::set_value_t>(
+                cudax_async::get_env(cudax_async::schedule(sched)))
+              == sched);
+  CUDAX_CHECK(cudax_async::get_forward_progress_guarantee(sched) == cudax_async::forward_progress_guarantee::parallel);
+  CUDAX_CHECK(pool.available_parallelism() == 2);
+}
+
+TEST_CASE("static_thread_pool runs work on its threads", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto snd = cudax_async::start_on(pool.get_scheduler(), cudax_async::just(42)) | cudax_async::then([](int i) {
+               return std::make_pair(i, std::this_thread::get_id());
+             });
+  auto [result] = cudax_async::sync_wait(std::move(snd)).value();
+  CUDAX_CHECK(result.first == 42);
+  CUDAX_CHECK(result.second != std::this_thread::get_id());
+}
+
+TEST_CASE("static_thread_pool works with continue_on and when_all", "[static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{3};
+  auto sched = pool.get_scheduler();
+  auto snd   = cudax_async::when_all(cudax_async::start_on(sched, cudax_async::just(1)),
+                                   cudax_async::start_on(sched, cudax_async::just(2)),
+                                   cudax_async::just(3) | cudax_async::continue_on(sched))
+           | cudax_async::then([](int a, int b, int c) {
+               return a + b + c;
+             });
+  check_values(std::move(snd), 6);
+}
+
+// Every task of a binary tree schedules its two children on the pool, so the
+// workers steal from each other
+void spawn_tree(cudax_async::static_thread_pool& pool, int depth, std::atomic<int>& leaves)
+{
+  cudax_async::start_detached(cudax_async::schedule(pool.get_scheduler()) | cudax_async::then([&pool, depth, &leaves] {
+                                if (depth == 0)
+                                {
+                                  leaves.fetch_add(1);
+                                }
+                                else
+                                {
+                                  spawn_tree(pool, depth - 1, leaves);
+                                  spawn_tree(pool, depth - 1, leaves);
+                                }
+                              }));
+}
+
+TEST_CASE("static_thread_pool runs tasks scheduled from its workers", "[static_thread_pool]")
+{
+  std::atomic<int> leaves{0};
+  {
+    cudax_async::static_thread_pool pool{4};
+    spawn_tree(pool, 12, leaves);
+    while (leaves.load() != (1 << 12))
+    {
+      std::this_thread::yield();
+    }
+  }
+  CUDAX_CHECK(leaves.load() == (1 << 12));
+}
+
+TEST_CASE("static_thread_pool runs the work scheduled before its destruction", "[static_thread_pool]")
+{
+  std::atomic<int> count{0};
+  {
+    cudax_async::static_thread_pool pool{2};
+    for (int i = 0; i < 100; ++i)
+    {
+      cudax_async::start_detached(cudax_async::schedule(pool.get_scheduler()) | cudax_async::then([&count] {
+                                    count.fetch_add(1);
+                                  }));
+    }
+  }
+  CUDAX_CHECK(count.load() == 100);
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the latency and the throughput of host threads waiting on atomic
+// objects. Objects of system scope park their waiters, while objects of block
+// scope are waited on by polling with backoff, which makes the two directly
+// comparable. The CPU time is reported next to the wall time: a waiter that
+// parks should not consume any.
+
+#include <cuda/atomic>
+#include <cuda/std/chrono>
+#include <cuda/std/semaphore>
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+#include <type_traits>
+
+struct measurement
+{
+  double wall_us;
+  double cpu_us;
+};
+
+template <class F>
+measurement measure(int iterations, F f)
+{
+  auto const wall_begin = std::chrono::steady_clock::now();
+  auto const cpu_begin  = std::clock();
+  f();
+  auto const cpu_end  = std::clock();
+  auto const wall_end = std::chrono::steady_clock::now();
+
+  double const wall = std::chrono::duration<double, std::micro>(wall_end - wall_begin).count();
+  double const cpu  = 1e6 * double(cpu_end - cpu_begin) / CLOCKS_PER_SEC;
+  return {wall / iterations, cpu / iterations};
+}
+
+// Two threads take turns incrementing a counter, each waiting for the other's
+// increment. Every round trip is two notifications of a waiting thread.
+template <cuda::thread_scope Scope>
+measurement ping_pong(int rounds)
+{
+  cuda::atomic<int, Scope> counter(0);
+
+  return measure(rounds, [&] {
+    std::thread other([&] {
+      for (int i = 0; i < rounds; ++i)
+      {
+        counter.wait(2 * i);
+        counter.store(2 * i + 2);
+        counter.notify_one();
+      }
+    });
+    for (int i = 0; i < rounds; ++i)
+    {
+      counter.store(2 * i + 1);
+      counter.notify_one();
+      counter.wait(2 * i + 1);
+    }
+    other.join();
+  });
+}
+
+// A producer releases a semaphore that a consumer acquires, item by item.
+template <cuda::thread_scope Scope>
+measurement semaphore_throughput(int items)
+{
+  cuda::counting_semaphore<Scope> ready(0);
+
+  return measure(items, [&] {
+    std::thread consumer([&] {
+      for (int i = 0; i < items; ++i)
+      {
+        ready.acquire();
+      }
+    });
+    for (int i = 0; i < items; ++i)
+    {
+      ready.release();
+    }
+    consumer.join();
+  });
+}
+
+// A thread sleeps for a while before it notifies another one; the excess of
+// the wall time over the sleep is the wakeup latency.
+template <cuda::thread_scope Scope>
+measurement wakeup_latency(int wakeups)
+{
+  cuda::atomic<int, Scope> flag(0);
+  auto const sleep = std::chrono::microseconds(200);
+
+  measurement m = measure(wakeups, [&] {
+    for (int i = 0; i < wakeups; ++i)
+    {
+      std::thread notifier([&] {
+        std::this_thread::sleep_for(sleep);
+        flag.store(i + 1);
+        flag.notify_all();
+      });
+      flag.wait(i);
+      notifier.join();
+    }
+  });
+  m.wall_us -= std::chrono::duration<double, std::micro>(sleep).count();
+  return m;
+}
+
+template <class F>
+void report(char const* name, int iterations, F f)
+{
+  measurement const parked = f(std::integral_constant<cuda::thread_scope, cuda::thread_scope_system>{}, iterations);
+  measurement const polled = f(std::integral_constant<cuda::thread_scope, cuda::thread_scope_block>{}, iterations);
+  std::printf("%-24s parked %10.2f us (%8.2f us cpu)   polled %10.2f us (%8.2f us cpu)\n",
+              name,
+              parked.wall_us,
+              parked.cpu_us,
+              polled.wall_us,
+              polled.cpu_us);
+}
+
+int main()
+{
+  report("ping-pong round trip", 20000, [](auto scope, int n) {
+    return ping_pong<decltype(scope)::value>(n);
+  });
+  report("semaphore item", 200000, [](auto scope, int n) {
+    return semaphore_throughput<decltype(scope)::value>(n);
+  });
+  report("wakeup latency", 200, [](auto scope, int n) {
+    return wakeup_latency<decltype(scope)::value>(n);
+  });
+  return 0;
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Measures the time per phase of host threads synchronizing in a loop on a
+// cuda::barrier, whose arrivals all update one counter, and on a
+// cuda::tree_barrier, whose arrivals combine in a tree, from 2 to 256 threads.
+
+#include <cuda/barrier>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+struct completion
+{
+  int* phases;
+
+  void operator()() noexcept
+  {
+    ++*phases;
+  }
+};
+
+template <class Barrier>
+double time_per_phase(int threads, int phases)
+{
+  int completed = 0;
+  Barrier barrier(threads, completion{&completed});
+
+  auto const begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t)
+  {
+    pool.emplace_back([&] {
+      for (int p = 0; p < phases; ++p)
+      {
+        barrier.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& thread : pool)
+  {
+    thread.join();
+  }
+  auto const end = std::chrono::steady_clock::now();
+
+  if (completed != phases)
+  {
+    std::printf("error: %d phases completed out of %d\n", completed, phases);
+  }
+  return std::chrono::duration<double, std::micro>(end - begin).count() / phases;
+}
+
+int main()
+{
+  std::printf("%8s %16s %16s\n", "threads", "counter (us)", "tree (us)");
+  for (int threads = 2; threads <= 256; threads *= 2)
+  {
+    int const phases = 20000 / threads + 100;
+    double const counter =
+      time_per_phase<cuda::barrier<cuda::thread_scope_system, completion>>(threads, phases);
+    double const tree =
+      time_per_phase<cuda::tree_barrier<cuda::thread_scope_system, completion>>(threads, phases);
+    std::printf("%8d %16.2f %16.2f\n", threads, counter, tree);
+  }
+  return 0;
+}
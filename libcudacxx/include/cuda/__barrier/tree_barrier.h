@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__barrier/empty_completion.h>
+#include <cuda/std/__barrier/tree_barrier.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+//! A host barrier with the interface of cuda::barrier, whose arrivals combine
+//! in a tree instead of contending on a single counter. It scales to many more
+//! host threads, at the cost of a heap allocation and a logarithmic number of
+//! atomic operations per arrival.
+template <thread_scope _Sco, class _CompletionF = _CUDA_VSTD::__empty_completion>
+class tree_barrier : public _CUDA_VSTD::__tree_barrier_base<_CompletionF, _Sco>
+{
+public:
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST explicit tree_barrier(_CUDA_VSTD::ptrdiff_t __expected,
+                                                       _CompletionF __completion = _CompletionF())
+      : _CUDA_VSTD::__tree_barrier_base<_CompletionF, _Sco>(__expected, __completion)
+  {}
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -70,7 +70,9 @@ template <typename _Tp>
 inline auto __atomic_load_host(_Tp* __a, memory_order __order) -> remove_cv_t<_Tp>
 {
   remove_cv_t<_Tp> __ret;
-  __atomic_load(&__atomic_force_align_host(__a)->__atom, &__ret, __atomic_order_to_int(__order));
+  // A load has no release half. Mapping the order like a failure order keeps GCC from diagnosing release and acq_rel
+  // on the paths it finds through an order that is not a constant, such as in an atomic wait it does not inline.
+  __atomic_load(&__atomic_force_align_host(__a)->__atom, &__ret, __atomic_failure_order_to_int(__order));
   return __ret;
 }
 
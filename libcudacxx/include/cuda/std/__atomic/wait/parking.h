@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
+#define _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
+#include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+// Host threads waiting on an atomic object park in the kernel instead of
+// polling it with backoff, which either burns CPU or oversleeps a notification
+// by up to a millisecond.
+#if !defined(_LIBCUDACXX_HAS_NO_THREADS) && defined(_LIBCUDACXX_HAS_THREAD_API_PTHREAD) && defined(__linux__)
+#  define _LIBCUDACXX_HAS_ATOMIC_PARKING
+#endif
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Objects of block scope, or narrower, are waited on by polling; they are not
+// expected to be shared by many host threads.
+template <typename _Sco>
+struct __atomic_scope_parks : false_type
+{};
+template <>
+struct __atomic_scope_parks<__thread_scope_device_tag> : true_type
+{};
+template <>
+struct __atomic_scope_parks<__thread_scope_system_tag> : true_type
+{};
+
+// Objects of system scope may live in memory shared with other processes
+template <typename _Sco>
+struct __atomic_scope_is_process_shared : false_type
+{};
+template <>
+struct __atomic_scope_is_process_shared<__thread_scope_system_tag> : true_type
+{};
+
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+
+// A thread parks on the futex of the 4-byte word holding the object if there is
+// one, or otherwise on the version counter of a slot selected by hashing the
+// address of the object. Either way, the slot counts the parked threads, so
+// that notifying an object nobody waits on does not enter the kernel, unless
+// threads of other processes may park on its word.
+struct _CCCL_ALIGNAS(64) __cccl_parking_slot
+{
+  int __waiters;
+  int __version;
+};
+
+// The table must be unique in the process, so that an object notified from one
+// shared library wakes up threads parked on it in another.
+_CCCL_VISIBILITY_DEFAULT inline __cccl_parking_slot& __cccl_parking_slot_for(const volatile void* __addr)
+{
+  static __cccl_parking_slot __slots[256];
+  return __slots[(reinterpret_cast<uintptr_t>(__addr) * 0x9E3779B97F4A7C15ull) >> 56];
+}
+
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+_LIBCUDACXX_HIDE_FROM_ABI const volatile void* __atomic_parking_address(_Sto const volatile* __a)
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+_LIBCUDACXX_HIDE_FROM_ABI const volatile void* __atomic_parking_address(_Sto const volatile* __a)
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+_LIBCUDACXX_HIDE_FROM_ABI const volatile void* __atomic_parking_address(_Sto const volatile* __a)
+{
+  return &__a->__a_value;
+}
+
+// Whether the parking address of the object is a 4-byte word holding its value
+template <typename _Sto>
+struct __atomic_parks_on_word
+    : bool_constant<_Sto::__tag == __atomic_tag::__atomic_small_tag
+                    || (_Sto::__tag == __atomic_tag::__atomic_base_tag
+                        && sizeof(__atomic_underlying_remove_cv_t<_Sto>) == sizeof(int))>
+{};
+
+// The contents of the parking word of an object holding the given value
+template <typename _Sto>
+_LIBCUDACXX_HIDE_FROM_ABI int __atomic_parking_word(__atomic_underlying_remove_cv_t<_Sto> const& __val)
+{
+  int __word;
+  if constexpr (_Sto::__tag == __atomic_tag::__atomic_small_tag)
+  {
+    auto const __proxy = __atomic_small_to_32(__val);
+    _CUDA_VSTD::memcpy(&__word, &__proxy, sizeof(int));
+  }
+  else
+  {
+    _CUDA_VSTD::memcpy(&__word, &__val, sizeof(int));
+  }
+  return __word;
+}
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI bool __atomic_parking_unchanged(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> const& __val, memory_order __order, _Sco)
+{
+  __atomic_underlying_remove_cv_t<_Tp> const __current = __atomic_load_dispatch(__a, __order, _Sco{});
+  return _CUDA_VSTD::memcmp(&__current, &__val, sizeof(__val)) == 0;
+}
+
+// Threads of other processes can share system scope objects, but not the
+// table, so a thread parked on the table is not woken up by their
+// notifications, and neither is any thread by notifications from the device.
+// Parked threads wake up after this long to check such objects.
+_LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::nanoseconds __atomic_parking_timeout(__thread_scope_system_tag)
+{
+  return _CUDA_VSTD::chrono::milliseconds(1);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::nanoseconds __atomic_parking_timeout(__thread_scope_device_tag)
+{
+  return _CUDA_VSTD::chrono::nanoseconds::zero();
+}
+
+#endif // _LIBCUDACXX_HAS_ATOMIC_PARKING
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+  if constexpr (__atomic_scope_parks<_Sco>::value)
+  {
+    const volatile void* const __addr = __atomic_parking_address(__a);
+    __cccl_parking_slot& __slot       = __cccl_parking_slot_for(__addr);
+
+    // the fences order the registration of the waiter and the check of the
+    // object against the store to the object and the check for waiters in
+    // the notification
+    __atomic_fetch_add(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if constexpr (__atomic_parks_on_word<_Tp>::value)
+    {
+      if (__atomic_parking_unchanged(__a, __val, __order, _Sco{}))
+      {
+        __cccl_futex_wait(static_cast<int const volatile*>(__addr),
+                          __atomic_parking_word<_Tp>(__val),
+                          __atomic_parking_timeout(_Sco{}),
+                          __atomic_scope_is_process_shared<_Sco>::value);
+      }
+    }
+    else
+    {
+      // the version is read before the object, so that a notification after
+      // the check makes the futex wait return immediately
+      int const __version = __atomic_load_n(&__slot.__version, __ATOMIC_ACQUIRE);
+      if (__atomic_parking_unchanged(__a, __val, __order, _Sco{}))
+      {
+        __cccl_futex_wait(&__slot.__version, __version, __atomic_parking_timeout(_Sco{}), false);
+      }
+    }
+
+    __atomic_fetch_sub(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+    return;
+  }
+#endif // _LIBCUDACXX_HAS_ATOMIC_PARKING
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_HIDE_FROM_ABI void
+__atomic_notify_host([[maybe_unused]] _Tp const volatile* __a, [[maybe_unused]] bool __all, _Sco)
+{
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+  if constexpr (__atomic_scope_parks<_Sco>::value)
+  {
+    const volatile void* const __addr = __atomic_parking_address(__a);
+
+    if constexpr (__atomic_parks_on_word<_Tp>::value && __atomic_scope_is_process_shared<_Sco>::value)
+    {
+      // the table does not count the threads of other processes parked on the
+      // word, so they are always woken up
+      __cccl_futex_wake(static_cast<int const volatile*>(__addr), __all ? INT_MAX : 1, true);
+      return;
+    }
+
+    __cccl_parking_slot& __slot = __cccl_parking_slot_for(__addr);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&__slot.__waiters, __ATOMIC_RELAXED) == 0)
+    {
+      return;
+    }
+
+    if constexpr (__atomic_parks_on_word<_Tp>::value)
+    {
+      __cccl_futex_wake(static_cast<int const volatile*>(__addr), __all ? INT_MAX : 1, false);
+    }
+    else
+    {
+      // other objects may share the slot, so all of its threads are woken up
+      __atomic_fetch_add(&__slot.__version, 1, __ATOMIC_RELEASE);
+      __cccl_futex_wake(&__slot.__version, INT_MAX, false);
+    }
+  }
+#endif // _LIBCUDACXX_HAS_ATOMIC_PARKING
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ATOMIC_WAIT_PARKING_H
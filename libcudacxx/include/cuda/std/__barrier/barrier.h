@@ -158,6 +158,17 @@ private:
   {
     return __try_wait_phase(__parity ? __phase_bit : 0);
   }
+  // The word changes with every arrival, but is only notified when the phase
+  // flips, so host threads can park on it until then.
+  _LIBCUDACXX_HIDE_FROM_ABI void __wait_phase(uint64_t __phase) const
+  {
+    uint64_t __current = __phase_arrived_expected.load(memory_order_acquire);
+    while ((__current & __phase_bit) == __phase)
+    {
+      __phase_arrived_expected.wait(__current, memory_order_acquire);
+      __current = __phase_arrived_expected.load(memory_order_acquire);
+    }
+  }
 
 public:
   _CCCL_HIDE_FROM_ABI __barrier_base() = default;
@@ -186,12 +197,17 @@ public:
   }
   _LIBCUDACXX_HIDE_FROM_ABI void wait(arrival_token&& __phase) const
   {
-    _CUDA_VSTD::__cccl_thread_poll_with_backoff(
-      __barrier_poll_tester_phase<__barrier_base>(this, _CUDA_VSTD::move(__phase)));
+    NV_IF_ELSE_TARGET(NV_IS_HOST,
+                      (__wait_phase(__phase & __phase_bit);),
+                      (_CUDA_VSTD::__cccl_thread_poll_with_backoff(
+                         __barrier_poll_tester_phase<__barrier_base>(this, _CUDA_VSTD::move(__phase)));))
   }
   _LIBCUDACXX_HIDE_FROM_ABI void wait_parity(bool __parity) const
   {
-    _CUDA_VSTD::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));
+    NV_IF_ELSE_TARGET(
+      NV_IS_HOST,
+      (__wait_phase(__parity ? __phase_bit : 0);),
+      (_CUDA_VSTD::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));))
   }
   _LIBCUDACXX_HIDE_FROM_ABI void arrive_and_wait()
   {
@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __LIBCUDACXX___BARRIER_TREE_BARRIER_H
+#define __LIBCUDACXX___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__barrier/empty_completion.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+// A small number that is distinct for every host thread that asks for it, so
+// that threads arriving at the same time start from different nodes of a tree.
+_CCCL_HIDE_FROM_ABI _CCCL_HOST size_t __cccl_thread_index() noexcept
+{
+  static atomic<size_t> __next(0);
+  static thread_local size_t const __index = __next.fetch_add(1, memory_order_relaxed);
+  return __index;
+}
+
+// Every node of the tree pairs up two arrivals per round on a ticket of its
+// own, and is padded so that nodes do not share cache lines. Any ticket is
+// contended by two threads at most.
+template <thread_scope _Sco>
+struct _CCCL_ALIGNAS(64) __tree_barrier_node
+{
+  // enough rounds to combine max() arrivals
+  static constexpr int __rounds = 8 * sizeof(ptrdiff_t);
+
+  __atomic_impl<uint8_t, _Sco> __tickets[__rounds];
+};
+
+// A barrier whose arrivals meet in a combining tree instead of on one counter.
+// In every round, the arrivals pair up on the tickets of half as many nodes as
+// there were arrivals, and the second of every pair carries on to the next
+// round. The arrival that is left alone in the last round completes the phase.
+// Arrivals only contend with their partner, which scales to many host threads
+// at the cost of log(expected) atomic operations per arrival. The tree is
+// allocated on the heap, so the barrier is only usable on the host.
+template <class _CompletionF, thread_scope _Sco = thread_scope_system>
+class __tree_barrier_base
+{
+  using __node = __tree_barrier_node<_Sco>;
+
+  // the phase advances by two, so that each ticket can tell a half step (one
+  // arrival of a pair) from a full step (both of them)
+  __atomic_impl<uint8_t, _Sco> __phase;
+  ptrdiff_t __expected;
+  __atomic_impl<ptrdiff_t, _Sco> __expected_adjustment;
+  _CompletionF __completion;
+  __node* __nodes;
+
+  // Returns whether this arrival is the last one of the phase
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST bool __arrive_tree(uint8_t __old_phase)
+  {
+    uint8_t const __half_step = static_cast<uint8_t>(__old_phase + 1);
+    uint8_t const __full_step = static_cast<uint8_t>(__old_phase + 2);
+
+    size_t __current_expected = static_cast<size_t>(__expected);
+    size_t __current          = __cccl_thread_index() % ((__current_expected + 1) >> 1);
+
+    for (int __round = 0;; ++__round)
+    {
+      if (__current_expected <= 1)
+      {
+        return true;
+      }
+      size_t const __end_node  = (__current_expected + 1) >> 1;
+      size_t const __last_node = __end_node - 1;
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        auto& __ticket   = __nodes[__current].__tickets[__round];
+        uint8_t __expect = __old_phase;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // the last node of an odd round has a single arrival
+          if (__ticket.compare_exchange_strong(__expect, __full_step, memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__expect, __half_step, memory_order_acq_rel))
+        {
+          return false;
+        }
+        else if (__expect == __half_step)
+        {
+          if (__ticket.compare_exchange_strong(__expect, __full_step, memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+      }
+      __current_expected = __last_node + 1;
+      __current >>= 1;
+    }
+  }
+
+public:
+  using arrival_token = uint8_t;
+
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST explicit __tree_barrier_base(
+    ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __phase(0)
+      , __expected(__expected)
+      , __expected_adjustment(0)
+      , __completion(__completion)
+      , __nodes(new __node[static_cast<size_t>((__expected + 1) >> 1)]())
+  {
+    _CCCL_ASSERT(__expected >= 0, "Count must be non-negative.");
+  }
+
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST ~__tree_barrier_base()
+  {
+    delete[] __nodes;
+  }
+
+  __tree_barrier_base(__tree_barrier_base const&)            = delete;
+  __tree_barrier_base& operator=(__tree_barrier_base const&) = delete;
+
+  [[nodiscard]] _CCCL_HIDE_FROM_ABI _CCCL_HOST arrival_token arrive(ptrdiff_t __update = 1)
+  {
+    auto const __old_phase = __phase.load(memory_order_relaxed);
+    for (; __update; --__update)
+    {
+      if (__arrive_tree(__old_phase))
+      {
+        // every other arrival of the phase has happened before, and none of
+        // the next phase can happen until the phase is stored
+        __completion();
+        __expected += __expected_adjustment.load(memory_order_relaxed);
+        __expected_adjustment.store(0, memory_order_relaxed);
+        __phase.store(static_cast<uint8_t>(__old_phase + 2), memory_order_release);
+        __phase.notify_all();
+      }
+    }
+    return __old_phase;
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void wait(arrival_token&& __old_phase) const
+  {
+    __phase.wait(__old_phase, memory_order_acquire);
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+  _CCCL_HIDE_FROM_ABI _CCCL_HOST void arrive_and_drop()
+  {
+    __expected_adjustment.fetch_sub(1, memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI static constexpr ptrdiff_t max() noexcept
+  {
+    return numeric_limits<ptrdiff_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // __LIBCUDACXX___BARRIER_TREE_BARRIER_H
@@ -22,7 +22,11 @@
 
 #if !defined(_LIBCUDACXX_HAS_NO_THREADS)
 
+#  include <cuda/std/__atomic/platform.h>
+#  include <cuda/std/__type_traits/remove_cvref.h>
+#  include <cuda/std/__utility/forward.h>
 #  include <cuda/std/chrono>
+#  include <cuda/std/cstdint>
 
 #  if defined(_LIBCUDACXX_HAS_THREAD_API_EXTERNAL)
 #    include <cuda/std/__thread/threading_support_external.h>
@@ -57,24 +61,195 @@ _LIBCUDACXX_HIDE_FROM_ABI void __cccl_thread_yield_processor()
   NV_IF_TARGET(NV_IS_HOST, __LIBCUDACXX_ASM_THREAD_YIELD)
 }
 
-template <class _Fn>
-_LIBCUDACXX_HIDE_FROM_ABI bool __cccl_thread_poll_with_backoff(
-  _Fn&& __f, _CUDA_VSTD::chrono::nanoseconds __max = _CUDA_VSTD::chrono::nanoseconds::zero())
+// What a polling thread did to back off after its condition failed
+enum class __cccl_backoff_stage
+{
+  __spin,
+  __yield,
+  __sleep,
+};
+
+#  if defined(CCCL_ENABLE_BACKOFF_STATISTICS)
+
+// The number of polling loops on the host that ended after spinning only, after
+// yielding at least once, and after sleeping at least once, to guide the tuning
+// of the backoff policies.
+struct __cccl_backoff_statistics
+{
+  uint64_t __spun;
+  uint64_t __yielded;
+  uint64_t __slept;
+};
+
+_CCCL_VISIBILITY_DEFAULT inline __cccl_backoff_statistics& __cccl_get_backoff_statistics() noexcept
+{
+  static __cccl_backoff_statistics __statistics{};
+  return __statistics;
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_record_backoff([[maybe_unused]] __cccl_backoff_stage __stage)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (__cccl_backoff_statistics& __statistics = _CUDA_VSTD::__cccl_get_backoff_statistics();
+                uint64_t* const __counter = __stage == __cccl_backoff_stage::__spin    ? &__statistics.__spun
+                                          : __stage == __cccl_backoff_stage::__yield ? &__statistics.__yielded
+                                                                                     : &__statistics.__slept;
+                __atomic_fetch_add(__counter, uint64_t{1}, __ATOMIC_RELAXED);))
+}
+
+#  else // ^^^ CCCL_ENABLE_BACKOFF_STATISTICS ^^^ / vvv !CCCL_ENABLE_BACKOFF_STATISTICS vvv
+
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_record_backoff(__cccl_backoff_stage) {}
+
+#  endif // !CCCL_ENABLE_BACKOFF_STATISTICS
+
+// A backoff policy of __cccl_thread_poll_with_backoff. The condition is first
+// polled __spin_count times, with __pauses pause instructions between the polls
+// after the first __pause_count. Then the thread yields until __yield_for has
+// passed since the first poll, and sleeps for a quarter of the time waited so
+// far, but no longer than __max_sleep, from then on.
+struct __cccl_fixed_backoff
+{
+  int __spin_count                            = _LIBCUDACXX_POLLING_COUNT;
+  int __pause_count                           = _LIBCUDACXX_POLLING_COUNT >> 1;
+  int __pauses                                = 1;
+  _CUDA_VSTD::chrono::nanoseconds __yield_for = _CUDA_VSTD::chrono::microseconds(40);
+  _CUDA_VSTD::chrono::nanoseconds __max_sleep = _CUDA_VSTD::chrono::milliseconds(1);
+
+  _LIBCUDACXX_HIDE_FROM_ABI void __spin(int __count) const
+  {
+    if (__count > __pause_count)
+    {
+      for (int __i = 0; __i < __pauses; ++__i)
+      {
+        _CUDA_VSTD::__cccl_thread_yield_processor();
+      }
+    }
+  }
+
+  // How long to sleep once the condition has failed for __elapsed, or zero to
+  // yield instead
+  _LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::nanoseconds __sleep_step(_CUDA_VSTD::chrono::nanoseconds __elapsed) const
+  {
+    if (__elapsed < __yield_for)
+    {
+      return _CUDA_VSTD::chrono::nanoseconds::zero();
+    }
+    _CUDA_VSTD::chrono::nanoseconds const __step = __elapsed / 4;
+    return __step < __max_sleep ? __step : __max_sleep;
+  }
+
+  // Called with the time the condition took to hold, or zero if it held
+  // before the spinning ended
+  _LIBCUDACXX_HIDE_FROM_ABI void __learn(_CUDA_VSTD::chrono::nanoseconds) const {}
+};
+
+// The default backoff policy. It keeps a moving average of how long the waits
+// of the call site identified by _Tag take on the host, and is the fixed
+// backoff until it has learned a few of them. Short waits are yielded through
+// for up to twice as long. Longer ones sleep for half of the time remaining
+// until the typical wait is over. Only when waits typically end while sleeping
+// does the longest sleep step shrink, to a sixteenth of the typical wait, so
+// that threads wake up close to when waits of the call site usually end. On the
+// device, it is the fixed backoff.
+template <class _Tag>
+struct __cccl_adaptive_backoff : __cccl_fixed_backoff
+{
+  // The number of waits of the call site learned before departing from the
+  // fixed backoff
+  static constexpr int __learned_waits = 8;
+
+  _CUDA_VSTD::chrono::nanoseconds __typical_wait = _CUDA_VSTD::chrono::nanoseconds::zero();
+
+  _LIBCUDACXX_HIDE_FROM_ABI __cccl_adaptive_backoff()
+  {
+    NV_IF_TARGET(NV_IS_HOST,
+                 (if (__atomic_load_n(&__history().__samples, __ATOMIC_RELAXED) >= __learned_waits) {
+                   __adapt(_CUDA_VSTD::chrono::nanoseconds(__atomic_load_n(&__history().__typical, __ATOMIC_RELAXED)));
+                 }))
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _CUDA_VSTD::chrono::nanoseconds __sleep_step(_CUDA_VSTD::chrono::nanoseconds __elapsed) const
+  {
+    if (__yield_for <= __elapsed && __elapsed < __typical_wait)
+    {
+      _CUDA_VSTD::chrono::nanoseconds const __step = (__typical_wait - __elapsed) / 2;
+      _CUDA_VSTD::chrono::nanoseconds const __min  = _CUDA_VSTD::chrono::microseconds(10);
+      return __step < __min ? __min : __step < __max_sleep ? __step : __max_sleep;
+    }
+    return __cccl_fixed_backoff::__sleep_step(__elapsed);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI void __learn([[maybe_unused]] _CUDA_VSTD::chrono::nanoseconds __elapsed) const
+  {
+    // concurrent updates may get lost, which does not matter for an estimate
+    NV_IF_TARGET(
+      NV_IS_HOST,
+      (int const __samples = __atomic_load_n(&__history().__samples, __ATOMIC_RELAXED);
+       int64_t const __old = __atomic_load_n(&__history().__typical, __ATOMIC_RELAXED);
+       int64_t const __new = __samples == 0 ? __elapsed.count() : __old + (__elapsed.count() - __old) / 8;
+       __atomic_store_n(&__history().__typical, __new, __ATOMIC_RELAXED);
+       if (__samples < __learned_waits) {
+         __atomic_store_n(&__history().__samples, __samples + 1, __ATOMIC_RELAXED);
+       }))
+  }
+
+private:
+  struct __wait_history
+  {
+    int64_t __typical;
+    int __samples;
+  };
+
+  static _CCCL_HIDE_FROM_ABI _CCCL_HOST __wait_history& __history() noexcept
+  {
+    static __wait_history __h{};
+    return __h;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI void __adapt(_CUDA_VSTD::chrono::nanoseconds __typical_wait_)
+  {
+    _CUDA_VSTD::chrono::nanoseconds const __yield_min = _CUDA_VSTD::chrono::microseconds(40);
+    _CUDA_VSTD::chrono::nanoseconds const __yield_max = _CUDA_VSTD::chrono::microseconds(100);
+    _CUDA_VSTD::chrono::nanoseconds const __sleep_min = _CUDA_VSTD::chrono::microseconds(10);
+
+    _CUDA_VSTD::chrono::nanoseconds const __yield = 2 * __typical_wait_;
+    _CUDA_VSTD::chrono::nanoseconds const __sleep = __typical_wait_ / 16;
+
+    __typical_wait = __typical_wait_;
+    __yield_for    = __yield < __yield_min ? __yield_min : __yield < __yield_max ? __yield : __yield_max;
+
+    // waits that end while spinning or yielding say nothing about how long the
+    // others take, which thus keep the ceiling of the fixed backoff
+    if (__yield_for < __typical_wait_ && __sleep < __max_sleep)
+    {
+      __max_sleep = __sleep < __sleep_min ? __sleep_min : __sleep;
+    }
+  }
+};
+
+// Polls __f until it returns true, backing off as told by __backoff, or until
+// __max has passed unless it is zero. Returns whether __f returned true.
+template <class _Fn, class _Backoff>
+_LIBCUDACXX_HIDE_FROM_ABI bool
+__cccl_thread_poll_with_backoff(_Fn&& __f, _CUDA_VSTD::chrono::nanoseconds __max, _Backoff __backoff)
 {
   _CUDA_VSTD::chrono::high_resolution_clock::time_point const __start =
     _CUDA_VSTD::chrono::high_resolution_clock::now();
+  __cccl_backoff_stage __stage = __cccl_backoff_stage::__spin;
   for (int __count = 0;;)
   {
     if (__f())
     {
+      __backoff.__learn(__stage == __cccl_backoff_stage::__spin
+                          ? _CUDA_VSTD::chrono::nanoseconds::zero()
+                          : _CUDA_VSTD::chrono::high_resolution_clock::now() - __start);
+      _CUDA_VSTD::__cccl_record_backoff(__stage);
       return true;
     }
-    if (__count < _LIBCUDACXX_POLLING_COUNT)
+    if (__count < __backoff.__spin_count)
     {
-      if (__count > (_LIBCUDACXX_POLLING_COUNT >> 1))
-      {
-        _CUDA_VSTD::__cccl_thread_yield_processor();
-      }
+      __backoff.__spin(__count);
       __count += 1;
       continue;
     }
@@ -82,24 +257,31 @@ _LIBCUDACXX_HIDE_FROM_ABI bool __cccl_thread_poll_with_backoff(
       _CUDA_VSTD::chrono::high_resolution_clock::now() - __start;
     if (__max != _CUDA_VSTD::chrono::nanoseconds::zero() && __max < __elapsed)
     {
+      _CUDA_VSTD::__cccl_record_backoff(__stage);
       return false;
     }
-    _CUDA_VSTD::chrono::nanoseconds const __step = __elapsed / 4;
-    if (__step >= _CUDA_VSTD::chrono::milliseconds(1))
+    _CUDA_VSTD::chrono::nanoseconds const __step = __backoff.__sleep_step(__elapsed);
+    if (__step == _CUDA_VSTD::chrono::nanoseconds::zero())
     {
-      _CUDA_VSTD::__cccl_thread_sleep_for(_CUDA_VSTD::chrono::milliseconds(1));
-    }
-    else if (__step >= _CUDA_VSTD::chrono::microseconds(10))
-    {
-      _CUDA_VSTD::__cccl_thread_sleep_for(__step);
+      _CUDA_VSTD::__cccl_thread_yield();
+      __stage = __stage < __cccl_backoff_stage::__yield ? __cccl_backoff_stage::__yield : __stage;
     }
     else
     {
-      _CUDA_VSTD::__cccl_thread_yield();
+      _CUDA_VSTD::__cccl_thread_sleep_for(__step);
+      __stage = __cccl_backoff_stage::__sleep;
     }
   }
 }
 
+template <class _Fn>
+_LIBCUDACXX_HIDE_FROM_ABI bool __cccl_thread_poll_with_backoff(
+  _Fn&& __f, _CUDA_VSTD::chrono::nanoseconds __max = _CUDA_VSTD::chrono::nanoseconds::zero())
+{
+  return _CUDA_VSTD::__cccl_thread_poll_with_backoff(
+    _CUDA_VSTD::forward<_Fn>(__f), __max, __cccl_adaptive_backoff<remove_cvref_t<_Fn>>());
+}
+
 _LIBCUDACXX_END_NAMESPACE_STD
 
 _CCCL_POP_MACROS
@@ -175,6 +175,32 @@ _LIBCUDACXX_HIDE_FROM_ABI void __cccl_thread_sleep_for(_CUDA_VSTD::chrono::nanos
     ;
 }
 
+// Futex
+#  if defined(__linux__)
+
+// Blocks while *__addr == __val until woken up, or until __rel_time has passed
+// unless it is zero. Spurious wakeups are possible. A futex of a word that other
+// processes may map is not private, or their wakeups would not reach it.
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_futex_wait(
+  int const volatile* __addr, int __val, _CUDA_VSTD::chrono::nanoseconds const& __rel_time, bool __process_shared)
+{
+  __cccl_timespec_t __ts = __cccl_to_timespec(__rel_time);
+  syscall(SYS_futex,
+          __addr,
+          __process_shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE,
+          __val,
+          __rel_time == _CUDA_VSTD::chrono::nanoseconds::zero() ? nullptr : &__ts,
+          nullptr,
+          0);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_futex_wake(int const volatile* __addr, int __count, bool __process_shared)
+{
+  syscall(SYS_futex, __addr, __process_shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+
+#  endif // __linux__
+
 _LIBCUDACXX_END_NAMESPACE_STD
 
 _CCCL_POP_MACROS
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+template <cuda::thread_scope Sco>
+void test_completion()
+{
+  int phases = 0;
+
+  auto comp = [&] {
+    ++phases;
+  };
+
+  cuda::tree_barrier<Sco, decltype(comp)> b(3, comp);
+
+  auto worker = [&] {
+    for (int i = 0; i < 10; ++i)
+    {
+      b.arrive_and_wait();
+    }
+  };
+
+  concurrent_agents_launch(worker, worker, worker);
+
+  assert(phases == 10);
+}
+
+template <cuda::thread_scope Sco>
+void test_arrive_and_drop()
+{
+  cuda::tree_barrier<Sco> b(3);
+
+  auto dropper = [&] {
+    b.arrive_and_drop();
+  };
+  auto worker = [&] {
+    for (int i = 0; i < 10; ++i)
+    {
+      b.arrive_and_wait();
+    }
+  };
+
+  concurrent_agents_launch(dropper, worker, worker);
+}
+
+template <cuda::thread_scope Sco>
+void test_arrive_update()
+{
+  cuda::tree_barrier<Sco> b(5);
+
+  auto single = [&] {
+    for (int i = 0; i < 10; ++i)
+    {
+      b.arrive_and_wait();
+    }
+  };
+  auto multiple = [&] {
+    for (int i = 0; i < 10; ++i)
+    {
+      b.wait(b.arrive(4));
+    }
+  };
+
+  concurrent_agents_launch(single, multiple);
+}
+
+template <cuda::thread_scope Sco>
+void test()
+{
+  test_completion<Sco>();
+  test_arrive_and_drop<Sco>();
+  test_arrive_update<Sco>();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (cuda_thread_count = 3;
+
+                test<cuda::thread_scope_block>();
+                test<cuda::thread_scope_device>();
+                test<cuda::thread_scope_system>();))
+
+  return 0;
+}
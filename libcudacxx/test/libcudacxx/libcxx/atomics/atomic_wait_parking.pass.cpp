@@ -0,0 +1,145 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+
+// Host threads waiting on device and system scope atomics park in the kernel
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/chrono>
+
+#include "test_macros.h"
+
+#if defined(_LIBCUDACXX_HAS_ATOMIC_PARKING)
+
+#  include <sys/mman.h>
+#  include <sys/wait.h>
+
+#  include <thread>
+
+#  include <signal.h>
+#  include <unistd.h>
+
+// Waits until n threads are parked on the slot of the object
+template <class A>
+void wait_for_parked(A& a, int n)
+{
+  cuda::std::__cccl_parking_slot& slot = cuda::std::__cccl_parking_slot_for(cuda::std::__atomic_parking_address(&a.__a));
+  while (__atomic_load_n(&slot.__waiters, __ATOMIC_RELAXED) < n)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+// Device scope waits have no timeout, so a lost notification hangs
+template <class T>
+void test_notify_one()
+{
+  cuda::atomic<T, cuda::thread_scope_device> a(T(0));
+
+  std::thread waiter([&] {
+    a.wait(T(0));
+    assert(a.load() == T(1));
+  });
+
+  wait_for_parked(a, 1);
+  a.store(T(1));
+  a.notify_one();
+  waiter.join();
+}
+
+template <class T>
+void test_notify_all()
+{
+  cuda::atomic<T, cuda::thread_scope_device> a(T(0));
+
+  auto wait = [&] {
+    a.wait(T(0));
+    assert(a.load() == T(1));
+  };
+  std::thread waiters[] = {std::thread(wait), std::thread(wait), std::thread(wait)};
+
+  wait_for_parked(a, 3);
+  a.store(T(1));
+  a.notify_all();
+  for (auto& waiter : waiters)
+  {
+    waiter.join();
+  }
+}
+
+// A thread of another process parked on a system scope word is woken up by the
+// notification, rather than by the timeout of system scope waits
+void test_process_shared()
+{
+  using A = cuda::atomic<int, cuda::thread_scope_system>;
+
+  void* const shared = mmap(nullptr, sizeof(A), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  assert(shared != MAP_FAILED);
+  A* const a = new (shared) A(0);
+
+  pid_t const child = fork();
+  assert(child != -1);
+  if (child == 0)
+  {
+    // parks with no timeout, so that a private notification, which never
+    // reaches it, makes the alarm kill it
+    alarm(10);
+    while (a->load() == 0)
+    {
+      cuda::std::__cccl_futex_wait(
+        static_cast<int const volatile*>(cuda::std::__atomic_parking_address(&a->__a)),
+        0,
+        cuda::std::chrono::nanoseconds::zero(),
+        true);
+    }
+    _exit(0);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  a->store(1);
+  a->notify_one();
+
+  int status = 0;
+  assert(waitpid(child, &status, 0) == child);
+  assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  a->~A();
+  munmap(shared, sizeof(A));
+}
+
+void test()
+{
+  // parked on the word of the object
+  test_notify_one<int>();
+  test_notify_one<short>();
+  test_notify_all<int>();
+  test_notify_all<char>();
+
+  // parked on the slot of the object
+  test_notify_one<long long>();
+  test_notify_all<double>();
+
+  test_process_shared();
+}
+
+#else // ^^^ _LIBCUDACXX_HAS_ATOMIC_PARKING ^^^ / vvv !_LIBCUDACXX_HAS_ATOMIC_PARKING vvv
+
+void test() {}
+
+#endif // !_LIBCUDACXX_HAS_ATOMIC_PARKING
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+
+  return 0;
+}
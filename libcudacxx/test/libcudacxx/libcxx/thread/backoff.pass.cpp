@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+
+// The backoff policies of __cccl_thread_poll_with_backoff
+
+#define CCCL_ENABLE_BACKOFF_STATISTICS
+
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/cassert>
+#include <cuda/std/chrono>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+using cuda::std::chrono::microseconds;
+using cuda::std::chrono::milliseconds;
+using cuda::std::chrono::nanoseconds;
+
+void test_fixed()
+{
+  cuda::std::__cccl_fixed_backoff backoff;
+
+  // yields for 40 us, then sleeps for a quarter of the time waited, up to 1 ms
+  assert(backoff.__sleep_step(nanoseconds(0)) == nanoseconds(0));
+  assert(backoff.__sleep_step(microseconds(39)) == nanoseconds(0));
+  assert(backoff.__sleep_step(microseconds(40)) == microseconds(10));
+  assert(backoff.__sleep_step(microseconds(400)) == microseconds(100));
+  assert(backoff.__sleep_step(milliseconds(4)) == milliseconds(1));
+  assert(backoff.__sleep_step(milliseconds(1000)) == milliseconds(1));
+}
+
+template <int>
+struct tag
+{};
+
+template <class Tag>
+void learn(nanoseconds elapsed, int count)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag>().__learn(elapsed);
+  }
+}
+
+template <class Tag>
+void assert_fixed()
+{
+  cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+  assert(backoff.__typical_wait == nanoseconds(0));
+  assert(backoff.__yield_for == microseconds(40));
+  assert(backoff.__max_sleep == milliseconds(1));
+  assert(backoff.__sleep_step(milliseconds(1000)) == milliseconds(1));
+}
+
+void test_adaptive_without_history()
+{
+  using Tag = tag<0>;
+
+  assert_fixed<Tag>();
+
+  // too few waits to go by
+  learn<Tag>(milliseconds(2), cuda::std::__cccl_adaptive_backoff<Tag>::__learned_waits - 1);
+  assert_fixed<Tag>();
+}
+
+void test_adaptive_short_waits()
+{
+  using Tag = tag<1>;
+
+  // waits which end while spinning keep the ceiling of the fixed backoff
+  learn<Tag>(nanoseconds(0), 100);
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+    assert(backoff.__max_sleep == milliseconds(1));
+    assert(backoff.__sleep_step(milliseconds(1000)) == milliseconds(1));
+  }
+
+  // and so do waits which end while yielding
+  learn<Tag>(microseconds(30), 100);
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+    assert(microseconds(59) < backoff.__yield_for && backoff.__yield_for <= microseconds(60));
+    assert(backoff.__max_sleep == milliseconds(1));
+  }
+}
+
+void test_adaptive_long_waits()
+{
+  using Tag = tag<2>;
+
+  learn<Tag>(microseconds(1600), cuda::std::__cccl_adaptive_backoff<Tag>::__learned_waits);
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+    assert(backoff.__typical_wait == microseconds(1600));
+    assert(backoff.__yield_for == microseconds(100));
+    assert(backoff.__max_sleep == microseconds(100));
+
+    // sleeps for half of the time remaining until the typical wait is over,
+    // then in steps of at most a sixteenth of it
+    assert(backoff.__sleep_step(microseconds(50)) == nanoseconds(0));
+    assert(backoff.__sleep_step(microseconds(1500)) == microseconds(50));
+    assert(backoff.__sleep_step(microseconds(1590)) == microseconds(10));
+    assert(backoff.__sleep_step(milliseconds(1000)) == microseconds(100));
+  }
+
+  // the typical wait converges to the waits of the call site
+  learn<Tag>(microseconds(320), 64);
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+    assert(microseconds(319) < backoff.__typical_wait && backoff.__typical_wait < microseconds(321));
+    assert(microseconds(19) < backoff.__max_sleep && backoff.__max_sleep < microseconds(21));
+  }
+  learn<Tag>(microseconds(6400), 64);
+  {
+    cuda::std::__cccl_adaptive_backoff<Tag> backoff;
+    assert(microseconds(6390) < backoff.__typical_wait && backoff.__typical_wait < microseconds(6410));
+    assert(microseconds(399) < backoff.__max_sleep && backoff.__max_sleep < microseconds(401));
+  }
+}
+
+void test_poll()
+{
+  int polls = 0;
+  auto after_three = [&] {
+    return ++polls == 3;
+  };
+  assert(cuda::std::__cccl_thread_poll_with_backoff(after_three, nanoseconds(0), cuda::std::__cccl_fixed_backoff()));
+  assert(polls == 3);
+
+  auto never = [] {
+    return false;
+  };
+  assert(!cuda::std::__cccl_thread_poll_with_backoff(never, milliseconds(2), cuda::std::__cccl_fixed_backoff()));
+}
+
+void test_statistics()
+{
+  cuda::std::__cccl_backoff_statistics const before = cuda::std::__cccl_get_backoff_statistics();
+
+  auto now = [] {
+    return true;
+  };
+  cuda::std::__cccl_thread_poll_with_backoff(now);
+
+  auto const start = cuda::std::chrono::high_resolution_clock::now();
+  auto later       = [&] {
+    return milliseconds(2) < cuda::std::chrono::high_resolution_clock::now() - start;
+  };
+  cuda::std::__cccl_thread_poll_with_backoff(later);
+
+  cuda::std::__cccl_backoff_statistics const after = cuda::std::__cccl_get_backoff_statistics();
+  assert(after.__spun == before.__spun + 1);
+  assert(after.__yielded == before.__yielded);
+  assert(after.__slept == before.__slept + 1);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_fixed();
+                test_adaptive_without_history();
+                test_adaptive_short_waits();
+                test_adaptive_long_waits();
+                test_poll();
+                test_statistics();))
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/histogram.h>
+
+#include <cstdint>
+#include <limits>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#  include <tbb/info.h>
+#endif
+
+#include "nvbench_helper.cuh"
+
+// Strong scaling of thrust::histogram_even on the CPU backends, up to a billion samples in bins which divide the
+// whole range of the samples.
+template <typename T>
+static void even(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto num_threads = static_cast<int>(state.get_int64("Threads"));
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (num_threads > omp_get_num_procs())
+  {
+    state.skip("Threads exceeds the number of available processors.");
+    return;
+  }
+  omp_set_num_threads(num_threads);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  if (num_threads > ::tbb::info::default_concurrency())
+  {
+    state.skip("Threads exceeds the number of available processors.");
+    return;
+  }
+  ::tbb::global_control control(::tbb::global_control::max_allowed_parallelism, num_threads);
+#else
+  if (num_threads != 1)
+  {
+    state.skip("Thread scaling is only measured for the OpenMP and TBB backends.");
+    return;
+  }
+#endif
+
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto num_bins = static_cast<int>(state.get_int64("Bins"));
+
+  const auto lower_level = static_cast<std::int64_t>(std::numeric_limits<T>::min());
+  const auto upper_level = static_cast<std::int64_t>(std::numeric_limits<T>::max()) + 1;
+
+  thrust::device_vector<T> samples = generate(elements);
+  thrust::device_vector<std::size_t> histogram(num_bins);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<std::size_t>(num_bins);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    thrust::histogram_even(
+      policy(alloc, launch), samples.begin(), samples.end(), histogram.begin(), num_bins + 1, lower_level, upper_level);
+  });
+}
+
+NVBENCH_BENCH_TYPES(even, NVBENCH_TYPE_AXES(nvbench::type_list<uint8_t, uint16_t>))
+  .set_name("even")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 7, 1))
+  .add_int64_power_of_two_axis("Elements", nvbench::range(26, 30, 2))
+  .add_int64_axis("Bins", {16, 256, 2048});
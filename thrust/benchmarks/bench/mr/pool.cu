@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Replaces random blocks out of a set of live blocks of mixed sizes, while as
+// many freed blocks are held in the cache of the pool. All blocks are oversized,
+// so every operation goes through the cache of oversized blocks.
+template <typename Pool>
+static void replace_blocks(nvbench::state& state, Pool& pool)
+{
+  const auto live_blocks = static_cast<std::size_t>(state.get_int64("LiveBlocks"));
+  const auto operations  = static_cast<std::size_t>(state.get_int64("Operations"));
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> size_dist(1024, 8192);
+  std::uniform_int_distribution<std::size_t> slot_dist(0, live_blocks - 1);
+
+  std::vector<std::size_t> sizes(operations);
+  std::vector<std::size_t> slots(operations);
+
+  for (std::size_t i = 0; i < operations; ++i)
+  {
+    sizes[i] = size_dist(rng);
+    slots[i] = slot_dist(rng);
+  }
+
+  std::vector<void*> blocks(live_blocks);
+  std::vector<std::size_t> block_sizes(live_blocks);
+
+  // fill the cache with as many free blocks as there are live ones
+  for (std::size_t i = 0; i < 2 * live_blocks; ++i)
+  {
+    const std::size_t slot = i % live_blocks;
+
+    if (i >= live_blocks)
+    {
+      pool.do_deallocate(blocks[slot], block_sizes[slot], alignof(std::max_align_t));
+    }
+
+    block_sizes[slot] = size_dist(rng);
+    blocks[slot]      = pool.do_allocate(block_sizes[slot], alignof(std::max_align_t));
+  }
+
+  state.add_element_count(operations);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+      const std::size_t slot = slots[i];
+
+      pool.do_deallocate(blocks[slot], block_sizes[slot], alignof(std::max_align_t));
+
+      block_sizes[slot] = sizes[i];
+      blocks[slot]      = pool.do_allocate(block_sizes[slot], alignof(std::max_align_t));
+    }
+    timer.stop();
+  });
+
+  for (std::size_t slot = 0; slot < live_blocks; ++slot)
+  {
+    pool.do_deallocate(blocks[slot], block_sizes[slot], alignof(std::max_align_t));
+  }
+}
+
+static void oversized(nvbench::state& state)
+{
+  using pool_t = thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options options = pool_t::get_default_options();
+  options.largest_block_size       = 512;
+
+  thrust::mr::new_delete_resource upstream;
+  pool_t pool(&upstream, options);
+
+  replace_blocks(state, pool);
+}
+
+static void disjoint_oversized(nvbench::state& state)
+{
+  using pool_t =
+    thrust::mr::disjoint_unsynchronized_pool_resource<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options options = pool_t::get_default_options();
+  options.largest_block_size       = 512;
+
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+  pool_t pool(&upstream, &bookkeeper, options);
+
+  replace_blocks(state, pool);
+}
+
+NVBENCH_BENCH(oversized)
+  .set_name("oversized")
+  .add_int64_power_of_two_axis("LiveBlocks", nvbench::range(8, 16, 4))
+  .add_int64_power_of_two_axis("Operations", nvbench::range(16, 16, 1));
+
+NVBENCH_BENCH(disjoint_oversized)
+  .set_name("disjoint_oversized")
+  .add_int64_power_of_two_axis("LiveBlocks", nvbench::range(8, 16, 4))
+  .add_int64_power_of_two_axis("Operations", nvbench::range(16, 16, 1));
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/sharded_pool.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// Every thread replaces random blocks out of its own set of live blocks of mixed sizes, all of which the pool serves
+// from its buckets. Half of the blocks that a thread deallocates were allocated by its neighbour, so that blocks keep
+// moving between threads.
+template <typename Pool>
+static void contention(nvbench::state& state, Pool& pool)
+{
+  const auto threads     = static_cast<std::size_t>(state.get_int64("Threads"));
+  const auto live_blocks = static_cast<std::size_t>(256);
+  const auto operations  = static_cast<std::size_t>(state.get_int64("Operations"));
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> size_dist(8, 4096);
+  std::uniform_int_distribution<std::size_t> slot_dist(0, live_blocks - 1);
+
+  std::vector<std::size_t> sizes(operations);
+  std::vector<std::size_t> slots(operations);
+
+  for (std::size_t i = 0; i < operations; ++i)
+  {
+    sizes[i] = size_dist(rng);
+    slots[i] = slot_dist(rng);
+  }
+
+  // the live blocks of all threads; thread t owns the slots [t * live_blocks, (t + 1) * live_blocks)
+  std::vector<void*> blocks(threads * live_blocks);
+  std::vector<std::size_t> block_sizes(threads * live_blocks);
+
+  for (std::size_t slot = 0; slot < blocks.size(); ++slot)
+  {
+    block_sizes[slot] = size_dist(rng);
+    blocks[slot]      = pool.do_allocate(block_sizes[slot], alignof(std::max_align_t));
+  }
+
+  // swap the odd slots of neighbouring threads, so that each thread deallocates blocks of another one
+  for (std::size_t t = 0; t + 1 < threads; t += 2)
+  {
+    for (std::size_t slot = 1; slot < live_blocks; slot += 2)
+    {
+      std::swap(blocks[t * live_blocks + slot], blocks[(t + 1) * live_blocks + slot]);
+      std::swap(block_sizes[t * live_blocks + slot], block_sizes[(t + 1) * live_blocks + slot]);
+    }
+  }
+
+  state.add_element_count(threads * operations);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+      workers.emplace_back([&, t] {
+        void** my_blocks            = blocks.data() + t * live_blocks;
+        std::size_t* my_block_sizes = block_sizes.data() + t * live_blocks;
+
+        for (std::size_t i = 0; i < operations; ++i)
+        {
+          const std::size_t slot = slots[(i + t) % operations];
+
+          pool.do_deallocate(my_blocks[slot], my_block_sizes[slot], alignof(std::max_align_t));
+
+          my_block_sizes[slot] = sizes[i];
+          my_blocks[slot]      = pool.do_allocate(my_block_sizes[slot], alignof(std::max_align_t));
+        }
+      });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+    timer.stop();
+  });
+
+  for (std::size_t slot = 0; slot < blocks.size(); ++slot)
+  {
+    pool.do_deallocate(blocks[slot], block_sizes[slot], alignof(std::max_align_t));
+  }
+}
+
+static void synchronized(nvbench::state& state)
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::synchronized_pool_resource<thrust::mr::new_delete_resource> pool(&upstream);
+
+  contention(state, pool);
+}
+
+static void sharded(nvbench::state& state)
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::sharded_pool_resource<thrust::mr::new_delete_resource> pool(&upstream);
+
+  contention(state, pool);
+}
+
+NVBENCH_BENCH(synchronized)
+  .set_name("synchronized")
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 1))
+  .add_int64_power_of_two_axis("Operations", nvbench::range(16, 16, 1));
+
+NVBENCH_BENCH(sharded)
+  .set_name("sharded")
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 1))
+  .add_int64_power_of_two_axis("Operations", nvbench::range(16, 16, 1));
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#  include <tbb/info.h>
+#endif
+
+#include "nvbench_helper.cuh"
+
+// Strong scaling of thrust::shuffle on the CPU backends, up to a billion elements.
+template <typename T>
+static void threads(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto num_threads = static_cast<int>(state.get_int64("Threads"));
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (num_threads > omp_get_num_procs())
+  {
+    state.skip("Threads exceeds the number of available processors.");
+    return;
+  }
+  omp_set_num_threads(num_threads);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  if (num_threads > ::tbb::info::default_concurrency())
+  {
+    state.skip("Threads exceeds the number of available processors.");
+    return;
+  }
+  ::tbb::global_control control(::tbb::global_control::max_allowed_parallelism, num_threads);
+#else
+  if (num_threads != 1)
+  {
+    state.skip("Thread scaling is only measured for the OpenMP and TBB backends.");
+    return;
+  }
+#endif
+
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  thrust::device_vector<T> data(elements);
+  thrust::sequence(data.begin(), data.end());
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    thrust::shuffle(policy(alloc, launch), data.begin(), data.end(), thrust::default_random_engine{});
+  });
+}
+
+NVBENCH_BENCH_TYPES(threads, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t>))
+  .set_name("threads")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 7, 1))
+  .add_int64_power_of_two_axis("Elements", nvbench::range(26, 30, 2));
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#endif
+
+#include "nvbench_helper.cuh"
+
+// Strong scaling of thrust::stable_sort on the OpenMP backend.
+template <typename T, typename CompareOp>
+static void scaling(nvbench::state& state, CompareOp op)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const auto num_threads = static_cast<int>(state.get_int64("Threads"));
+  if (num_threads > omp_get_num_procs())
+  {
+    state.skip("Threads exceeds the number of available processors.");
+    return;
+  }
+  omp_set_num_threads(num_threads);
+
+  const auto elements       = static_cast<std::size_t>(state.get_int64("Elements"));
+  const bit_entropy entropy = str_to_entropy(state.get_string("Entropy"));
+
+  thrust::device_vector<T> input = generate(elements, entropy);
+
+  thrust::device_vector<T> vec(elements);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch& launch, auto& timer) {
+    vec = input;
+    timer.start();
+    thrust::stable_sort(policy(alloc, launch), vec.begin(), vec.end(), op);
+    timer.stop();
+  });
+#else
+  state.skip("Thread scaling is only measured for the OpenMP backend.");
+#endif
+}
+
+// The custom comparator keeps the primitive-key fast paths out of the
+// measurement, so the numbers reflect the tile sort and the merge levels.
+template <typename T>
+static void threads(nvbench::state& state, nvbench::type_list<T>)
+{
+  scaling<T>(state, less_t{});
+}
+
+// thrust::less on primitive keys takes the parallel radix sort.
+template <typename T>
+static void radix_threads(nvbench::state& state, nvbench::type_list<T>)
+{
+  scaling<T>(state, thrust::less<T>{});
+}
+
+NVBENCH_BENCH_TYPES(threads, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t>))
+  .set_name("threads")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 7, 1))
+  .add_int64_power_of_two_axis("Elements", nvbench::range(24, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"});
+
+NVBENCH_BENCH_TYPES(radix_threads, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t, float, double>))
+  .set_name("radix_threads")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 7, 1))
+  .add_int64_power_of_two_axis("Elements", nvbench::range(24, 28, 4))
+  .add_string_axis("Entropy", {"1.000", "0.201"});
@@ -52,6 +52,29 @@ static void basic(nvbench::state& state, nvbench::type_list<T>)
   });
 }
 
+// Sorted needles let the CPU backends merge them with the haystack instead of
+// searching it from scratch for every needle.
+template <typename T>
+static void sorted_needles(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements      = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto needles_ratio = static_cast<std::size_t>(state.get_int64("NeedlesRatio"));
+  const auto needles       = needles_ratio * static_cast<std::size_t>(static_cast<double>(elements) / 100.0);
+
+  thrust::device_vector<T> data = generate(elements + needles);
+  thrust::device_vector<T> result(needles);
+  thrust::sort(data.begin(), data.begin() + elements);
+  thrust::sort(data.begin() + elements, data.end());
+
+  state.add_element_count(needles);
+
+  caching_allocator_t alloc;
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    thrust::lower_bound(
+      policy(alloc, launch), data.begin(), data.begin() + elements, data.begin() + elements, data.end(), result.begin());
+  });
+}
+
 using types = nvbench::type_list<int8_t, int16_t, int32_t, int64_t>;
 
 NVBENCH_BENCH_TYPES(basic, NVBENCH_TYPE_AXES(types))
@@ -59,3 +82,9 @@ NVBENCH_BENCH_TYPES(basic, NVBENCH_TYPE_AXES(types))
   .set_type_axes_names({"T{ct}"})
   .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
   .add_int64_axis("NeedlesRatio", {1, 25, 50});
+
+NVBENCH_BENCH_TYPES(sorted_needles, NVBENCH_TYPE_AXES(types))
+  .set_name("sorted_needles")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 28, 4))
+  .add_int64_axis("NeedlesRatio", {1, 25, 50});
@@ -0,0 +1,305 @@
+#include <thrust/histogram.h>
+#include <thrust/iterator/retag.h>
+
+#include <limits>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator
+histogram_even(my_system& system, RandomAccessIterator, RandomAccessIterator, OutputIterator result, int, Level, Level)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramEvenDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_even(sys, vec.begin(), vec.end(), vec.begin(), 2, 0, 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator
+histogram_even(my_tag, RandomAccessIterator, RandomAccessIterator, OutputIterator result, int, Level, Level)
+{
+  *result = 13;
+  return result;
+}
+
+void TestHistogramEvenDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_even(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()), thrust::retag<my_tag>(vec.begin()), 2, 0, 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchImplicit);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator histogram_range(
+  my_system& system,
+  RandomAccessIterator1,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  RandomAccessIterator2,
+  OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramRangeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(2);
+
+  my_system sys(0);
+  thrust::histogram_range(sys, vec.begin(), vec.end(), vec.begin(), vec.end(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchExplicit);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator histogram_range(
+  my_tag,
+  RandomAccessIterator1,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  RandomAccessIterator2,
+  OutputIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestHistogramRangeDispatchImplicit()
+{
+  thrust::device_vector<int> vec(2);
+
+  thrust::histogram_range(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchImplicit);
+
+template <class Vector>
+void TestHistogramEvenSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector samples{2, 6, 7, 2, 3, 0, 2, 2, 6, 99};
+  Vector histogram(4, T(-1));
+
+  // the bins are [0, 2), [2, 4), [4, 6) and [6, 8)
+  typename Vector::iterator end = thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 5, 0, 8);
+
+  Vector ref{1, 5, 0, 3};
+  ASSERT_EQUAL(histogram, ref);
+  ASSERT_EQUAL_QUIET(histogram.end(), end);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramEvenSimple);
+
+template <class Vector>
+void TestHistogramRangeSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector samples{2, 6, 7, 2, 3, 0, 2, 2, 6, 99};
+  Vector levels{0, 1, 2, 4, 8};
+  Vector histogram(4, T(-1));
+
+  typename Vector::iterator end = thrust::histogram_range(
+    samples.begin(), samples.end(), levels.begin(), levels.end(), histogram.begin());
+
+  Vector ref{1, 0, 5, 3};
+  ASSERT_EQUAL(histogram, ref);
+  ASSERT_EQUAL_QUIET(histogram.end(), end);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramRangeSimple);
+
+void TestHistogramEvenFloat()
+{
+  thrust::device_vector<float> samples{2.2f, 6.5f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f, -1.0f, 8.0f};
+  thrust::device_vector<int> histogram(4);
+
+  thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 5, 0.0f, 8.0f);
+
+  thrust::device_vector<int> ref{1, 5, 0, 3};
+  ASSERT_EQUAL(histogram, ref);
+}
+DECLARE_UNITTEST(TestHistogramEvenFloat);
+
+void TestHistogramEvenWideRange()
+{
+  using T = long long;
+
+  const T min = std::numeric_limits<T>::min();
+  const T max = std::numeric_limits<T>::max();
+
+  // the width of the range times the number of bins does not fit in 64 bits
+  thrust::device_vector<T> samples{
+    -(T(1) << 62) + 1, -(T(1) << 61) + 1, 1, (T(1) << 61) + 1, min, max, -(T(1) << 62) - 1, T(1) << 62};
+  thrust::device_vector<int> histogram(4);
+
+  thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 5, -(T(1) << 62), T(1) << 62);
+
+  thrust::device_vector<int> ref{1, 1, 1, 1};
+  ASSERT_EQUAL(histogram, ref);
+
+  // the bins are [min, 0) and [0, max)
+  samples = thrust::device_vector<T>{min, -1, 0, T(1) << 62, max - 1, max};
+  histogram.resize(2);
+
+  thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 3, min, max);
+
+  ref = thrust::device_vector<int>{2, 3};
+  ASSERT_EQUAL(histogram, ref);
+}
+DECLARE_UNITTEST(TestHistogramEvenWideRange);
+
+template <typename T>
+void TestHistogramEven(const size_t n)
+{
+  // the samples are in [0, 20], so some fall outside of the bins
+  thrust::host_vector<T> h_samples   = unittest::random_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  const int num_levels = 5;
+
+  thrust::host_vector<size_t> ref(num_levels - 1, 0);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    const double x = static_cast<double>(h_samples[i]);
+
+    if (2 <= x && x < 18)
+    {
+      ref[static_cast<size_t>((x - 2) / 4)]++;
+    }
+  }
+
+  thrust::host_vector<size_t> h_histogram(num_levels - 1);
+  thrust::device_vector<size_t> d_histogram(num_levels - 1);
+
+  thrust::histogram_even(h_samples.begin(), h_samples.end(), h_histogram.begin(), num_levels, T(2), T(18));
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), num_levels, T(2), T(18));
+
+  ASSERT_EQUAL(h_histogram, ref);
+  ASSERT_EQUAL(d_histogram, ref);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramEven);
+
+template <typename T>
+void TestHistogramRange(const size_t n)
+{
+  thrust::host_vector<T> h_samples   = unittest::random_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  thrust::host_vector<T> h_levels{T(1), T(2), T(3), T(5), T(8), T(13)};
+  thrust::device_vector<T> d_levels = h_levels;
+
+  thrust::host_vector<size_t> ref(h_levels.size() - 1, 0);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    for (size_t j = 0; j + 1 < h_levels.size(); j++)
+    {
+      if (h_levels[j] <= h_samples[i] && h_samples[i] < h_levels[j + 1])
+      {
+        ref[j]++;
+      }
+    }
+  }
+
+  thrust::host_vector<size_t> h_histogram(h_levels.size() - 1);
+  thrust::device_vector<size_t> d_histogram(d_levels.size() - 1);
+
+  thrust::histogram_range(h_samples.begin(), h_samples.end(), h_levels.begin(), h_levels.end(), h_histogram.begin());
+  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_levels.begin(), d_levels.end(), d_histogram.begin());
+
+  ASSERT_EQUAL(h_histogram, ref);
+  ASSERT_EQUAL(d_histogram, ref);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramRange);
+
+template <typename T>
+struct TestHistogramEvenSmallSamples
+{
+  void operator()()
+  {
+    // enough samples to count them by value, in bins narrower and wider than a value
+    const size_t n = (1 << 20) + 3;
+
+    thrust::host_vector<T> h_samples   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_samples = h_samples;
+
+    const int lower = static_cast<int>(std::numeric_limits<T>::min()) + 7;
+    const int upper = static_cast<int>(std::numeric_limits<T>::max()) - 5;
+
+    for (int num_bins : {1, 10, 256, 1000})
+    {
+      thrust::host_vector<size_t> ref(num_bins, 0);
+
+      for (size_t i = 0; i < n; i++)
+      {
+        const long long x = h_samples[i];
+
+        if (lower <= x && x < upper)
+        {
+          ref[static_cast<size_t>((x - lower) * num_bins / (upper - lower))]++;
+        }
+      }
+
+      thrust::device_vector<size_t> d_histogram(num_bins);
+
+      thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), num_bins + 1, lower, upper);
+
+      ASSERT_EQUAL(d_histogram, ref);
+    }
+  }
+};
+SimpleUnitTest<TestHistogramEvenSmallSamples,
+               unittest::type_list<signed char, unittest::uint8_t, unittest::int16_t, unittest::uint16_t>>
+  TestHistogramEvenSmallSamplesInstance;
+
+void TestHistogramEmpty()
+{
+  thrust::device_vector<int> samples;
+  thrust::device_vector<int> levels{0, 1, 2};
+  thrust::device_vector<int> histogram(2, 13);
+
+  thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 3, 0, 2);
+
+  thrust::device_vector<int> ref(2, 0);
+  ASSERT_EQUAL(histogram, ref);
+
+  histogram[0] = 13;
+  histogram[1] = 13;
+
+  thrust::histogram_range(samples.begin(), samples.end(), levels.begin(), levels.end(), histogram.begin());
+
+  ASSERT_EQUAL(histogram, ref);
+
+  // no bins
+  histogram[0] = 13;
+
+  thrust::device_vector<int>::iterator end =
+    thrust::histogram_range(levels.begin(), levels.end(), levels.begin(), levels.begin() + 1, histogram.begin());
+
+  ASSERT_EQUAL_QUIET(histogram.begin(), end);
+  ASSERT_EQUAL(13, histogram[0]);
+}
+DECLARE_UNITTEST(TestHistogramEmpty);
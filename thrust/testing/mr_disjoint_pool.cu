@@ -1,6 +1,7 @@
 #include <thrust/detail/config.h>
 
 #include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/disjoint_sharded_pool.h>
 #include <thrust/mr/disjoint_sync_pool.h>
 #include <thrust/mr/new.h>
 
@@ -185,6 +186,12 @@ void TestDisjointSynchronizedPool()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPool);
 
+void TestDisjointShardedPool()
+{
+  TestDisjointPool<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointShardedPool);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointPoolCachingOversized()
 {
@@ -263,6 +270,95 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+void TestDisjointShardedPoolCachingOversized()
+{
+  TestDisjointPoolCachingOversized<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointShardedPoolCachingOversized);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolCachingOversizedOutOfOrder()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(2048, 64);
+  upstream.id_to_allocate = 2;
+  alloc_id a2             = pool.do_allocate(4096, 32);
+  upstream.id_to_allocate = 3;
+  alloc_id a3             = pool.do_allocate(3072, 32);
+  upstream.id_to_allocate = 4;
+  alloc_id a4             = pool.do_allocate(2048, 128);
+
+  // make sure blocks are found by their pointer when they are not deallocated in the order of allocation
+  pool.do_deallocate(a3, 3072, 32);
+  pool.do_deallocate(a1, 2048, 64);
+  pool.do_deallocate(a4, 2048, 128);
+  pool.do_deallocate(a2, 4096, 32);
+
+  alloc_id b1 = pool.do_allocate(2048, 128);
+  ASSERT_EQUAL(b1.id, 4u);
+
+  // make sure the smallest block of the requested alignment which fits is used
+  alloc_id b2 = pool.do_allocate(2500, 32);
+  ASSERT_EQUAL(b2.id, 3u);
+
+  // make sure a smaller block with a bigger alignment is preferred to a larger one with the requested alignment
+  alloc_id b3 = pool.do_allocate(1500, 32);
+  ASSERT_EQUAL(b3.id, 1u);
+
+  // make sure that a new block is allocated when the only one big enough isn't aligned enough
+  upstream.id_to_allocate = 5;
+  alloc_id b4             = pool.do_allocate(4000, 64);
+  ASSERT_EQUAL(b4.id, 5u);
+
+  alloc_id b5 = pool.do_allocate(4000, 32);
+  ASSERT_EQUAL(b5.id, 2u);
+
+  // make sure that reused blocks are cached again with their own size and alignment
+  pool.do_deallocate(b3, 1500, 32);
+  pool.do_deallocate(b5, 4000, 32);
+  pool.do_deallocate(b1, 2048, 128);
+  pool.do_deallocate(b4, 4000, 64);
+  pool.do_deallocate(b2, 2500, 32);
+
+  alloc_id c1 = pool.do_allocate(2048, 64);
+  ASSERT_EQUAL(c1.id, 1u);
+
+  alloc_id c2 = pool.do_allocate(4000, 64);
+  ASSERT_EQUAL(c2.id, 5u);
+
+  pool.do_deallocate(c1, 2048, 64);
+  pool.do_deallocate(c2, 4000, 64);
+}
+
+void TestDisjointUnsynchronizedPoolCachingOversizedOutOfOrder()
+{
+  TestDisjointPoolCachingOversizedOutOfOrder<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolCachingOversizedOutOfOrder);
+
+void TestDisjointSynchronizedPoolCachingOversizedOutOfOrder()
+{
+  TestDisjointPoolCachingOversizedOutOfOrder<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversizedOutOfOrder);
+
+void TestDisjointShardedPoolCachingOversizedOutOfOrder()
+{
+  TestDisjointPoolCachingOversizedOutOfOrder<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointShardedPoolCachingOversizedOutOfOrder);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
@@ -282,3 +378,9 @@ void TestSynchronizedDisjointGlobalPool()
   TestDisjointGlobalPool<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedDisjointGlobalPool);
+
+void TestShardedDisjointGlobalPool()
+{
+  TestDisjointGlobalPool<thrust::mr::disjoint_sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedDisjointGlobalPool);
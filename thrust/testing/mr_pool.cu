@@ -2,8 +2,13 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -244,6 +249,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+  TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +364,89 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedBestFit()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  // four blocks of mixed sizes and alignments, which all end up in the same bin
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(4992, 64);
+  upstream.id_to_allocate  = 2;
+  tracked_pointer<void> a2 = pool.do_allocate(4608, 32);
+  upstream.id_to_allocate  = 3;
+  tracked_pointer<void> a3 = pool.do_allocate(4160, 32);
+  upstream.id_to_allocate  = 4;
+  tracked_pointer<void> a4 = pool.do_allocate(4608, 32);
+
+  // the most recently cached block is the largest one
+  pool.do_deallocate(a3, 4160, 32);
+  pool.do_deallocate(a4, 4608, 32);
+  pool.do_deallocate(a2, 4608, 32);
+  pool.do_deallocate(a1, 4992, 64);
+
+  // make sure the smallest block which fits is used, and not the first one which does
+  tracked_pointer<void> a5 = pool.do_allocate(4400, 32);
+  ASSERT_EQUAL(a5.id, 2u);
+
+  // make sure that a block of the right size with too small an alignment is passed over
+  tracked_pointer<void> a6 = pool.do_allocate(4400, 64);
+  ASSERT_EQUAL(a6.id, 1u);
+
+  tracked_pointer<void> a7 = pool.do_allocate(4100, 32);
+  ASSERT_EQUAL(a7.id, 3u);
+
+  // make sure that the size cutoff factor is respected for blocks cached in a larger bin
+  upstream.id_to_allocate  = 5;
+  tracked_pointer<void> a8 = pool.do_allocate(4608 / opts.cached_size_cutoff_factor, 32);
+  ASSERT_EQUAL(a8.id, 5u);
+
+  tracked_pointer<void> a9 = pool.do_allocate(4608 / opts.cached_size_cutoff_factor + 16, 32);
+  ASSERT_EQUAL(a9.id, 4u);
+
+  upstream.id_to_allocate = 0;
+
+  pool.do_deallocate(a9, 4608 / opts.cached_size_cutoff_factor + 16, 32);
+  pool.do_deallocate(a8, 4608 / opts.cached_size_cutoff_factor, 32);
+  pool.do_deallocate(a7, 4100, 32);
+  pool.do_deallocate(a6, 4400, 64);
+  pool.do_deallocate(a5, 4400, 32);
+}
+
+void TestUnsynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedBestFit);
+
+void TestSynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedBestFit);
+
+void TestShardedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversizedBestFit);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +466,78 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestShardedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  virtual void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    allocations.fetch_add(1);
+    return upstream.do_allocate(n, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  std::atomic<std::size_t> allocations{0};
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+void TestShardedPoolCrossThreadDeallocation()
+{
+  counting_resource upstream;
+  thrust::mr::sharded_pool_resource<counting_resource> pool(
+    &upstream, thrust::mr::sharded_pool_resource<counting_resource>::get_default_options(), 4);
+
+  const std::size_t block_count = 1000;
+  std::vector<void*> blocks(block_count);
+  std::size_t first_round_allocations = 0;
+  std::size_t mismatches              = 0;
+
+  // one thread allocates the blocks and another one deallocates them; the blocks must find their way back to the
+  // allocating thread, instead of piling up in the cache of the deallocating one
+  for (int round = 0; round < 20; ++round)
+  {
+    std::thread producer([&] {
+      for (std::size_t i = 0; i < block_count; ++i)
+      {
+        blocks[i] = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        *static_cast<std::size_t*>(blocks[i]) = i;
+      }
+    });
+    producer.join();
+
+    // a failed assertion on another thread would terminate the test program, so only count the mismatches there
+    std::thread consumer([&] {
+      for (std::size_t i = 0; i < block_count; ++i)
+      {
+        if (*static_cast<std::size_t*>(blocks[i]) != i)
+        {
+          ++mismatches;
+        }
+        pool.do_deallocate(blocks[i], 64, THRUST_MR_DEFAULT_ALIGNMENT);
+      }
+    });
+    consumer.join();
+    ASSERT_EQUAL(mismatches, 0u);
+
+    if (round == 0)
+    {
+      first_round_allocations = upstream.allocations.load();
+    }
+  }
+
+  // the caches hold at most a few batches of blocks each, so later rounds only need a few more chunks
+  ASSERT_LESS(upstream.allocations.load(), 2 * first_round_allocations);
+}
+DECLARE_UNITTEST(TestShardedPoolCrossThreadDeallocation);
@@ -0,0 +1,125 @@
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <memory>
+#include <vector>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+struct record_thread
+{
+  int* threads;
+  int* in_parallel;
+
+  void operator()(int i) const
+  {
+    threads[i]     = omp_get_thread_num();
+    in_parallel[i] = omp_in_parallel();
+  }
+};
+
+void TestOmpTuningNumThreads()
+{
+  const int n = 1 << 16;
+
+  std::vector<int> threads(n, -1);
+  std::vector<int> in_parallel(n, -1);
+
+  thrust::counting_iterator<int> first(0);
+
+  thrust::for_each(thrust::omp::par.with(thrust::omp::num_threads(2), thrust::omp::grain(1)),
+                   first,
+                   first + n,
+                   record_thread{threads.data(), in_parallel.data()});
+
+  for (int i = 0; i < n; i++)
+  {
+    ASSERT_EQUAL(threads[i] == 0 || threads[i] == 1, true);
+  }
+}
+DECLARE_UNITTEST(TestOmpTuningNumThreads);
+
+void TestOmpTuningGrain()
+{
+  const int n = 1000;
+
+  std::vector<int> threads(n, -1);
+  std::vector<int> in_parallel(n, -1);
+
+  thrust::counting_iterator<int> first(0);
+
+  // fewer than two grains run on the calling thread without a parallel region
+  thrust::for_each(thrust::omp::par.with(thrust::omp::num_threads(4), thrust::omp::grain(n)),
+                   first,
+                   first + n,
+                   record_thread{threads.data(), in_parallel.data()});
+
+  for (int i = 0; i < n; i++)
+  {
+    ASSERT_EQUAL(threads[i], 0);
+    ASSERT_EQUAL(in_parallel[i], 0);
+  }
+
+  // as do small ranges by default
+  thrust::for_each(thrust::omp::par, first, first + 16, record_thread{threads.data(), in_parallel.data()});
+
+  for (int i = 0; i < 16; i++)
+  {
+    ASSERT_EQUAL(in_parallel[i], 0);
+  }
+}
+DECLARE_UNITTEST(TestOmpTuningGrain);
+
+template <typename T>
+struct TestOmpTuningAlgorithms
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d_data = h_data;
+
+    auto policy = thrust::omp::par.with(
+      thrust::omp::num_threads(3), thrust::omp::schedule_dynamic(7), thrust::omp::grain(5), thrust::omp::simd());
+
+    ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+    thrust::host_vector<T> h_result(n);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+    thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+
+    thrust::stable_sort(h_data.begin(), h_data.end());
+    thrust::stable_sort(policy, d_data.begin(), d_data.end());
+    ASSERT_EQUAL(h_data, d_data);
+
+    thrust::sequence(h_result.begin(), h_result.end());
+    thrust::sequence(policy, d_result.begin(), d_result.end());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+};
+VariableUnitTest<TestOmpTuningAlgorithms, IntegralTypes> TestOmpTuningAlgorithmsInstance;
+
+void TestOmpTuningWithAllocator()
+{
+  thrust::host_vector<int> h_data   = unittest::random_integers<int>(10000);
+  thrust::device_vector<int> d_data = h_data;
+
+  std::allocator<int> alloc;
+
+  thrust::sort(h_data.begin(), h_data.end());
+  thrust::sort(thrust::omp::par(alloc).with(thrust::omp::num_threads(2), thrust::omp::grain(64)),
+               d_data.begin(),
+               d_data.end());
+
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestOmpTuningWithAllocator);
@@ -1,5 +1,7 @@
 #include <thrust/generate.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
+#include <thrust/transform.h>
 
 #include <sstream>
 
@@ -139,6 +141,53 @@ struct ValidateEngineUnequal
   }
 };
 
+template <typename Engine>
+struct ValidateEngineDiscard
+{
+  _CCCL_HOST_DEVICE bool operator()(void) const
+  {
+    bool result = true;
+
+    // discard from every position within a block, across block boundaries
+    for (unsigned int offset = 0; offset <= Engine::word_count; ++offset)
+    {
+      for (unsigned int z = 0; z <= 3 * Engine::word_count; ++z)
+      {
+        Engine e0(13), e1(13);
+        e0.discard(offset);
+        e1.discard(offset);
+
+        e0.discard(z);
+        for (unsigned int i = 0; i < z; ++i)
+        {
+          e1();
+        }
+
+        result &= (e0 == e1);
+        result &= (e0() == e1());
+      }
+    }
+
+    return result;
+  }
+};
+
+template <typename Engine>
+struct ValidateEngineKeyCounter
+{
+  _CCCL_HOST_DEVICE typename Engine::result_type operator()(unsigned int i) const
+  {
+    typename Engine::key_type key{};
+    key[0] = 13;
+
+    typename Engine::counter_type counter{};
+    counter[0] = i;
+
+    Engine e(key, counter);
+    return e();
+  }
+};
+
 template <typename Distribution, typename Engine>
 struct ValidateDistributionMin
 {
@@ -325,6 +374,93 @@ void TestEngineUnequal()
   ASSERT_EQUAL(true, d[0]);
 }
 
+template <typename Engine>
+void TestEngineDiscard()
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, d[0]);
+
+  // discard far enough for the counter to carry into its second word
+  Engine e0(13), e1(13);
+  typename Engine::counter_type counter{};
+  counter[0] = Engine::max;
+  e0.set_counter(counter);
+  e0.discard(Engine::word_count + 1);
+
+  counter[0] = 0;
+  counter[1] = 1;
+  e1.set_counter(counter);
+  e1();
+
+  ASSERT_EQUAL(true, e0 == e1);
+  ASSERT_EQUAL(e0(), e1());
+}
+
+template <typename Engine>
+void TestEngineGenerate()
+{
+  // fill ranges of every length from every position within a block
+  for (unsigned int offset = 0; offset <= Engine::word_count; ++offset)
+  {
+    for (unsigned int n = 0; n <= 3 * Engine::word_count; ++n)
+    {
+      Engine e0(13), e1(13);
+      e0.discard(offset);
+      e1.discard(offset);
+
+      thrust::host_vector<typename Engine::result_type> h(n);
+      e0.generate(h.begin(), h.end());
+
+      for (unsigned int i = 0; i < n; ++i)
+      {
+        ASSERT_EQUAL(e1(), h[i]);
+      }
+
+      ASSERT_EQUAL(true, e0 == e1);
+      ASSERT_EQUAL(e0(), e1());
+    }
+  }
+}
+
+template <typename Engine>
+void TestEngineKeyCounter()
+{
+  const unsigned int n = 1000;
+
+  // every element draws from its own block, which does not depend on the system
+  thrust::host_vector<typename Engine::result_type> h(n);
+  thrust::transform(thrust::counting_iterator<unsigned int>(0),
+                    thrust::counting_iterator<unsigned int>(n),
+                    h.begin(),
+                    ValidateEngineKeyCounter<Engine>());
+
+  thrust::device_vector<typename Engine::result_type> d(n);
+  thrust::transform(thrust::counting_iterator<unsigned int>(0),
+                    thrust::counting_iterator<unsigned int>(n),
+                    d.begin(),
+                    ValidateEngineKeyCounter<Engine>());
+
+  ASSERT_EQUAL(h, d);
+
+  // which is where an engine with the same key would be after as many blocks
+  Engine e(13);
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(true, e.get_counter()[0] == i);
+    ASSERT_EQUAL(e(), h[i]);
+    e.discard(Engine::word_count - 1);
+  }
+}
+
 void TestRanlux24BaseValidation()
 {
   using Engine = thrust::random::ranlux24_base;
@@ -670,6 +806,300 @@ void TestRanlux48Unequal()
 }
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
+void TestPhilox4x32Validation()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineValidation<Engine, 1955073260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+void TestPhilox4x32Min()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+void TestPhilox4x32Max()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+void TestPhilox4x32SaveRestore()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+void TestPhilox4x32Equal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+void TestPhilox4x32Unequal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+void TestPhilox4x32Discard()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Discard);
+
+void TestPhilox4x32Generate()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Generate);
+
+void TestPhilox4x64Validation()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+void TestPhilox4x64Min()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+void TestPhilox4x64Max()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+void TestPhilox4x64SaveRestore()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+void TestPhilox4x64Equal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+void TestPhilox4x64Unequal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+void TestPhilox4x64Discard()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Discard);
+
+void TestPhilox4x64Generate()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Generate);
+
+void TestThreefry4x32Validation()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineValidation<Engine, 112810865ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+void TestThreefry4x32Min()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+void TestThreefry4x32Max()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+void TestThreefry4x32SaveRestore()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+void TestThreefry4x32Equal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+void TestThreefry4x32Unequal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+void TestThreefry4x32Discard()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Discard);
+
+void TestThreefry4x32Generate()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Generate);
+
+void TestThreefry4x64Validation()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineValidation<Engine, 9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+void TestThreefry4x64Min()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+void TestThreefry4x64Max()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+void TestThreefry4x64SaveRestore()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+void TestThreefry4x64Equal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+void TestThreefry4x64Unequal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+void TestThreefry4x64Discard()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Discard);
+
+void TestThreefry4x64Generate()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineGenerate<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Generate);
+
+void TestCounterBasedEngineKeyCounter()
+{
+  TestEngineKeyCounter<thrust::random::philox4x32>();
+  TestEngineKeyCounter<thrust::random::philox4x64>();
+  TestEngineKeyCounter<thrust::random::threefry4x32>();
+  TestEngineKeyCounter<thrust::random::threefry4x64>();
+}
+DECLARE_UNITTEST(TestCounterBasedEngineKeyCounter);
+
+void TestCounterBasedEngineKnownAnswers()
+{
+  // the first blocks of the zero key, from the reference implementation of Salmon et al.
+  thrust::random::philox4x32 philox32({0, 0});
+  ASSERT_EQUAL(0x6627e8d5u, philox32());
+  ASSERT_EQUAL(0xe169c58du, philox32());
+  ASSERT_EQUAL(0xbc57ac4cu, philox32());
+  ASSERT_EQUAL(0x9b00dbd8u, philox32());
+
+  thrust::random::philox4x64 philox64({0, 0});
+  ASSERT_EQUAL(0x16554d9eca36314cull, philox64());
+  ASSERT_EQUAL(0xdb20fe9d672d0fdcull, philox64());
+  ASSERT_EQUAL(0xd7e772cee186176bull, philox64());
+  ASSERT_EQUAL(0x7e68b68aec7ba23bull, philox64());
+
+  thrust::random::threefry4x32 threefry32({0, 0, 0, 0});
+  ASSERT_EQUAL(0x9c6ca96au, threefry32());
+  ASSERT_EQUAL(0xe17eae66u, threefry32());
+  ASSERT_EQUAL(0xfc10ecd4u, threefry32());
+  ASSERT_EQUAL(0x5256a7d8u, threefry32());
+
+  thrust::random::threefry4x64 threefry64({0, 0, 0, 0});
+  ASSERT_EQUAL(0x09218ebde6c85537ull, threefry64());
+  ASSERT_EQUAL(0x55941f5266d86105ull, threefry64());
+  ASSERT_EQUAL(0x4bd25e16282434dcull, threefry64());
+  ASSERT_EQUAL(0xee29ec846bd2e40bull, threefry64());
+}
+DECLARE_UNITTEST(TestCounterBasedEngineKnownAnswers);
+
 _CCCL_DIAG_PUSH
 _CCCL_DIAG_SUPPRESS_MSVC(4305) // truncation warning
 template <typename Distribution, typename Validator>
@@ -1,3 +1,4 @@
+#include <thrust/functional.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/reduce.h>
@@ -151,6 +152,76 @@ struct TestReduceByKey
 };
 VariableUnitTest<TestReduceByKey, IntegralTypes> TestReduceByKeyInstance;
 
+template <typename K>
+struct TestReduceByKeyNonCommutative
+{
+  void operator()(const size_t n)
+  {
+    using V = unsigned int; // ValueType
+
+    // segments long enough to span the partitions of a parallel backend
+    thrust::host_vector<K> h_keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = static_cast<K>((i / 97) % 2);
+    }
+    thrust::host_vector<V> h_vals   = unittest::random_integers<V>(n);
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    thrust::host_vector<K> h_keys_output(n);
+    thrust::host_vector<V> h_vals_output(n);
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+
+    size_t h_size =
+      thrust::reduce_by_key(
+        h_keys.begin(),
+        h_keys.end(),
+        h_vals.begin(),
+        h_keys_output.begin(),
+        h_vals_output.begin(),
+        thrust::equal_to<K>(),
+        thrust::project1st<V, V>())
+        .first
+      - h_keys_output.begin();
+    size_t d_size =
+      thrust::reduce_by_key(
+        d_keys.begin(),
+        d_keys.end(),
+        d_vals.begin(),
+        d_keys_output.begin(),
+        d_vals_output.begin(),
+        thrust::equal_to<K>(),
+        thrust::project1st<V, V>())
+        .first
+      - d_keys_output.begin();
+
+    ASSERT_EQUAL(h_size, d_size);
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+
+    thrust::reduce_by_key(
+      h_keys.begin(),
+      h_keys.end(),
+      h_vals.begin(),
+      h_keys_output.begin(),
+      h_vals_output.begin(),
+      thrust::equal_to<K>(),
+      thrust::project2nd<V, V>());
+    thrust::reduce_by_key(
+      d_keys.begin(),
+      d_keys.end(),
+      d_vals.begin(),
+      d_keys_output.begin(),
+      d_vals_output.begin(),
+      thrust::equal_to<K>(),
+      thrust::project2nd<V, V>());
+
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+  }
+};
+VariableUnitTest<TestReduceByKeyNonCommutative, IntegralTypes> TestReduceByKeyNonCommutativeInstance;
+
 template <typename K>
 struct TestReduceByKeyToDiscardIterator
 {
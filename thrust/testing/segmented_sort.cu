@@ -0,0 +1,359 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  my_system& system, RandomAccessIterator, RandomAccessIterator, OffsetIterator1, OffsetIterator1, OffsetIterator2)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_sort(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  my_tag, RandomAccessIterator first, RandomAccessIterator, OffsetIterator1, OffsetIterator1, OffsetIterator2)
+{
+  *first = 13;
+}
+
+void TestSegmentedSortDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_sort(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchImplicit);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  my_system& system,
+  RandomAccessIterator1,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OffsetIterator1,
+  OffsetIterator1,
+  OffsetIterator2)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortByKeyDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_sort_by_key(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortByKeyDispatchExplicit);
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  my_tag,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  OffsetIterator1,
+  OffsetIterator1,
+  OffsetIterator2)
+{
+  *keys_first = 13;
+}
+
+void TestSegmentedSortByKeyDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_sort_by_key(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortByKeyDispatchImplicit);
+
+template <class Vector>
+void TestSegmentedSortSimple()
+{
+  Vector keys{8, 6, 7, 5, 3, 0, 9, 4, 2, 1};
+
+  // the segments are [0, 3), [3, 3), [4, 7) and [9, 10), and the last one is empty because its end is before its
+  // begin; the keys 5, 4 and 2 are in none of them
+  Vector begin_offsets{0, 3, 4, 9, 8};
+  Vector end_offsets{3, 3, 7, 10, 6};
+
+  thrust::segmented_sort(keys.begin(), keys.end(), begin_offsets.begin(), begin_offsets.end(), end_offsets.begin());
+
+  Vector ref{6, 7, 8, 5, 0, 3, 9, 4, 2, 1};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedSortSimple);
+
+template <class Vector>
+void TestSegmentedSortDescending()
+{
+  Vector keys{8, 6, 7, 5, 3, 0, 9};
+  Vector offsets{0, 3, 7};
+
+  thrust::segmented_sort(
+    keys.begin(), keys.end(), offsets.begin(), offsets.end() - 1, offsets.begin() + 1, thrust::greater<int>());
+
+  Vector ref{8, 7, 6, 9, 5, 3, 0};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedSortDescending);
+
+template <class Vector>
+void TestSegmentedSortByKeySimple()
+{
+  Vector keys{3, 1, 2, 2, 0, 7, 6};
+  Vector values{0, 1, 2, 3, 4, 5, 6};
+  Vector offsets{0, 3, 5};
+
+  thrust::segmented_sort_by_key(
+    keys.begin(), keys.end(), values.begin(), offsets.begin(), offsets.end() - 1, offsets.begin() + 1);
+
+  Vector ref_keys{1, 2, 3, 0, 2, 7, 6};
+  Vector ref_values{1, 2, 0, 4, 3, 5, 6};
+  ASSERT_EQUAL(ref_keys, keys);
+  ASSERT_EQUAL(ref_values, values);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedSortByKeySimple);
+
+// Segments of random sizes of at most max_size elements among n, with gaps between some of them, and some of them
+// empty because their end is before their begin.
+void random_segments(
+  size_t n, int max_size, thrust::host_vector<int>& begin_offsets, thrust::host_vector<int>& end_offsets)
+{
+  thrust::default_random_engine rng(static_cast<unsigned int>(n));
+  thrust::uniform_int_distribution<int> size(0, max_size);
+  thrust::uniform_int_distribution<int> gap(0, 3);
+
+  begin_offsets.clear();
+  end_offsets.clear();
+
+  int end = 0;
+
+  for (int i = 0; end < static_cast<int>(n); i++)
+  {
+    const int begin = (thrust::min) (end + (i % 5 == 0 ? gap(rng) : 0), static_cast<int>(n));
+    end             = (thrust::min) (begin + size(rng), static_cast<int>(n));
+
+    if (i % 7 == 3)
+    {
+      begin_offsets.push_back(end);
+      end_offsets.push_back(begin);
+    }
+    else
+    {
+      begin_offsets.push_back(begin);
+      end_offsets.push_back(end);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void segmented_sort_reference(thrust::host_vector<T>& keys,
+                              const thrust::host_vector<int>& begin_offsets,
+                              const thrust::host_vector<int>& end_offsets,
+                              Compare comp)
+{
+  for (size_t i = 0; i < begin_offsets.size(); i++)
+  {
+    if (begin_offsets[i] < end_offsets[i])
+    {
+      thrust::stable_sort(keys.begin() + begin_offsets[i], keys.begin() + end_offsets[i], comp);
+    }
+  }
+}
+
+template <typename T>
+void TestSegmentedSort(const size_t n)
+{
+  thrust::host_vector<int> h_begin_offsets, h_end_offsets;
+  random_segments(n, 100, h_begin_offsets, h_end_offsets);
+
+  thrust::device_vector<int> d_begin_offsets = h_begin_offsets;
+  thrust::device_vector<int> d_end_offsets   = h_end_offsets;
+
+  thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_keys = h_keys;
+
+  segmented_sort_reference(h_keys, h_begin_offsets, h_end_offsets, thrust::less<T>());
+  thrust::segmented_sort(
+    d_keys.begin(), d_keys.end(), d_begin_offsets.begin(), d_begin_offsets.end(), d_end_offsets.begin());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSort);
+
+template <typename T>
+void TestSegmentedSortByKey(const size_t n)
+{
+  thrust::host_vector<int> h_begin_offsets, h_end_offsets;
+  random_segments(n, 100, h_begin_offsets, h_end_offsets);
+
+  thrust::device_vector<int> d_begin_offsets = h_begin_offsets;
+  thrust::device_vector<int> d_end_offsets   = h_end_offsets;
+
+  // unique keys, so that their values are sorted into a single order
+  thrust::host_vector<int> h_keys(n);
+  thrust::sequence(h_keys.begin(), h_keys.end());
+  thrust::host_vector<unsigned int> permutation = unittest::random_integers<unsigned int>(n);
+  thrust::sort_by_key(permutation.begin(), permutation.end(), h_keys.begin());
+
+  thrust::host_vector<T> h_values = unittest::random_integers<T>(n);
+
+  thrust::device_vector<int> d_keys = h_keys;
+  thrust::device_vector<T> d_values = h_values;
+
+  for (size_t i = 0; i < h_begin_offsets.size(); i++)
+  {
+    if (h_begin_offsets[i] < h_end_offsets[i])
+    {
+      thrust::sort_by_key(h_keys.begin() + h_begin_offsets[i],
+                          h_keys.begin() + h_end_offsets[i],
+                          h_values.begin() + h_begin_offsets[i],
+                          thrust::greater<int>());
+    }
+  }
+
+  thrust::segmented_sort_by_key(
+    d_keys.begin(),
+    d_keys.end(),
+    d_values.begin(),
+    d_begin_offsets.begin(),
+    d_begin_offsets.end(),
+    d_end_offsets.begin(),
+    thrust::greater<int>());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSortByKey);
+
+void TestSegmentedSortLargeSegments()
+{
+  // enough elements for segments too large to sort alongside others, between many small ones
+  const size_t n = (1 << 18) + 5;
+
+  thrust::host_vector<int> h_begin_offsets, h_end_offsets;
+  random_segments(n, 1 << 16, h_begin_offsets, h_end_offsets);
+
+  // split some of the segments into many small ones
+  for (size_t i = 0, num_segments = h_begin_offsets.size(); i < num_segments; i += 3)
+  {
+    const int begin = h_begin_offsets[i];
+    const int end   = h_end_offsets[i];
+
+    h_end_offsets[i] = (thrust::min) (begin + 10, end);
+
+    for (int j = begin + 10; j < end; j += 10)
+    {
+      h_begin_offsets.push_back(j);
+      h_end_offsets.push_back((thrust::min) (j + 10, end));
+    }
+  }
+
+  thrust::device_vector<int> d_begin_offsets = h_begin_offsets;
+  thrust::device_vector<int> d_end_offsets   = h_end_offsets;
+
+  thrust::host_vector<unsigned int> h_keys   = unittest::random_integers<unsigned int>(n);
+  thrust::device_vector<unsigned int> d_keys = h_keys;
+
+  segmented_sort_reference(h_keys, h_begin_offsets, h_end_offsets, thrust::less<unsigned int>());
+  thrust::segmented_sort(
+    d_keys.begin(), d_keys.end(), d_begin_offsets.begin(), d_begin_offsets.end(), d_end_offsets.begin());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+
+  thrust::host_vector<unsigned int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::device_vector<unsigned int> d_values = h_values;
+
+  // the keys of every segment are now sorted, so sort them into descending order
+  for (size_t i = 0; i < h_begin_offsets.size(); i++)
+  {
+    if (h_begin_offsets[i] < h_end_offsets[i])
+    {
+      thrust::stable_sort_by_key(h_keys.begin() + h_begin_offsets[i],
+                                 h_keys.begin() + h_end_offsets[i],
+                                 h_values.begin() + h_begin_offsets[i],
+                                 thrust::greater<unsigned int>());
+    }
+  }
+
+  thrust::segmented_sort_by_key(
+    d_keys.begin(),
+    d_keys.end(),
+    d_values.begin(),
+    d_begin_offsets.begin(),
+    d_begin_offsets.end(),
+    d_end_offsets.begin(),
+    thrust::greater<unsigned int>());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+
+  // equal keys may be permuted, so only the sums of the values of the segments are known
+  for (size_t i = 0; i < h_begin_offsets.size(); i++)
+  {
+    if (h_begin_offsets[i] < h_end_offsets[i])
+    {
+      ASSERT_EQUAL(thrust::reduce(h_values.begin() + h_begin_offsets[i], h_values.begin() + h_end_offsets[i], 0ull),
+                   thrust::reduce(d_values.begin() + h_begin_offsets[i], d_values.begin() + h_end_offsets[i], 0ull));
+    }
+  }
+}
+DECLARE_UNITTEST(TestSegmentedSortLargeSegments);
+
+void TestSegmentedSortEmpty()
+{
+  thrust::device_vector<int> keys{3, 2, 1};
+  thrust::device_vector<int> values{4, 5, 6};
+  thrust::device_vector<int> offsets;
+
+  thrust::segmented_sort(keys.begin(), keys.end(), offsets.begin(), offsets.end(), offsets.begin());
+  thrust::segmented_sort_by_key(
+    keys.begin(), keys.end(), values.begin(), offsets.begin(), offsets.end(), offsets.begin());
+
+  thrust::device_vector<int> ref_keys{3, 2, 1};
+  thrust::device_vector<int> ref_values{4, 5, 6};
+  ASSERT_EQUAL(ref_keys, keys);
+  ASSERT_EQUAL(ref_values, values);
+}
+DECLARE_UNITTEST(TestSegmentedSortEmpty);
@@ -1,7 +1,13 @@
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator>
@@ -72,6 +78,29 @@ void TestStableSortSimple()
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestStableSortSimple);
 
+void TestStableSortSequentialMixedSignInts()
+{
+  const int min = std::numeric_limits<int>::min();
+  const int max = std::numeric_limits<int>::max();
+
+  const thrust::host_vector<int> keys{3, -1, 0, max, -40, min, 7, -1, 65536, -65536, 1, -2};
+  const thrust::host_vector<int> ref{min, -65536, -40, -2, -1, -1, 0, 1, 3, 7, 65536, max};
+
+  // the radix sort of the sequential backend has to order the negative keys before the positive ones
+  thrust::host_vector<int> h_keys = keys;
+  thrust::stable_sort(thrust::seq, h_keys.begin(), h_keys.end());
+  ASSERT_EQUAL(ref, h_keys);
+
+  h_keys = keys;
+  thrust::stable_sort(h_keys.begin(), h_keys.end());
+  ASSERT_EQUAL(ref, h_keys);
+
+  h_keys = keys;
+  thrust::sort(thrust::seq, h_keys.begin(), h_keys.end());
+  ASSERT_EQUAL(ref, h_keys);
+}
+DECLARE_UNITTEST(TestStableSortSequentialMixedSignInts);
+
 template <typename T>
 struct TestStableSort
 {
@@ -105,6 +134,41 @@ struct TestStableSortSemantics
 VariableUnitTest<TestStableSortSemantics, unittest::type_list<unittest::int8_t, unittest::int16_t, unittest::int32_t>>
   TestStableSortSemanticsInstance;
 
+template <typename T>
+struct TestStableSortSequentialLarge
+{
+  void operator()()
+  {
+    // large enough for the sequential radix sort to take wide digits and write-combine its scatter
+    const size_t n = (1 << 21) + 7;
+
+    // every third key is one of a thousand small ones, which repeat, and half of the others are negative
+    thrust::host_vector<T> keys = unittest::random_integers<T>(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+      if (i % 3 == 0)
+      {
+        keys[i] = static_cast<T>(static_cast<int>(i % 1000) - 500);
+      }
+      else if (std::is_floating_point<T>::value && i % 2 == 1)
+      {
+        keys[i] = -keys[i];
+      }
+    }
+
+    std::vector<T> ref(keys.begin(), keys.end());
+    std::stable_sort(ref.begin(), ref.end());
+
+    thrust::stable_sort(thrust::seq, keys.begin(), keys.end());
+
+    ASSERT_EQUAL(thrust::host_vector<T>(ref.begin(), ref.end()), keys);
+  }
+};
+SimpleUnitTest<TestStableSortSequentialLarge,
+               unittest::type_list<unittest::int32_t, unittest::uint64_t, unittest::int64_t, float, double>>
+  TestStableSortSequentialLargeInstance;
+
 template <typename T>
 struct comp_mod3
 {
@@ -1,7 +1,14 @@
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -120,3 +127,59 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+template <typename T>
+struct TestStableSortByKeySequentialLarge
+{
+  void operator()()
+  {
+    // large enough for the sequential radix sort to take wide digits and write-combine its scatter
+    const size_t n = (1 << 21) + 7;
+
+    // every third key is one of a thousand small ones, which repeat, and half of the others are negative
+    thrust::host_vector<T> keys = unittest::random_integers<T>(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+      if (i % 3 == 0)
+      {
+        keys[i] = static_cast<T>(static_cast<int>(i % 1000) - 500);
+      }
+      else if (std::is_floating_point<T>::value && i % 2 == 1)
+      {
+        keys[i] = -keys[i];
+      }
+    }
+
+    thrust::host_vector<int> values(n);
+    thrust::sequence(values.begin(), values.end());
+
+    std::vector<std::pair<T, int>> ref(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+      ref[i] = std::make_pair(keys[i], values[i]);
+    }
+
+    std::stable_sort(ref.begin(), ref.end(), [](const std::pair<T, int>& a, const std::pair<T, int>& b) {
+      return a.first < b.first;
+    });
+
+    thrust::stable_sort_by_key(thrust::seq, keys.begin(), keys.end(), values.begin());
+
+    thrust::host_vector<T> ref_keys(n);
+    thrust::host_vector<int> ref_values(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+      ref_keys[i]   = ref[i].first;
+      ref_values[i] = ref[i].second;
+    }
+
+    ASSERT_EQUAL(ref_keys, keys);
+    ASSERT_EQUAL(ref_values, values);
+  }
+};
+SimpleUnitTest<TestStableSortByKeySequentialLarge,
+               unittest::type_list<unittest::int32_t, unittest::uint64_t, unittest::int64_t, float, double>>
+  TestStableSortByKeySequentialLargeInstance;
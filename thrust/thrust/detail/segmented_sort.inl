@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/system/detail/adl/segmented_sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort_by_key()
+
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort(
+    select_system(system1, system2, system3), first, last, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_sort(
+    select_system(system1, system2, system3),
+    first,
+    last,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System4 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first);
+} // end segmented_sort_by_key()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OffsetIterator1>::type;
+  using System4 = typename thrust::iterator_system<OffsetIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    comp);
+} // end segmented_sort_by_key()
+
+THRUST_NAMESPACE_END
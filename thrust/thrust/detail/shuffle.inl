@@ -27,6 +27,7 @@
 #endif // no system header
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
 
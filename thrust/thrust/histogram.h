@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file histogram.h
+ *  \brief Counts the samples of a range that fall into each of a sequence of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup reductions
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \addtogroup histograms
+ *  \ingroup reductions
+ *  \{
+ */
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> that fall into each of <tt>num_levels - 1</tt>
+ *  bins of equal width, which evenly divide <tt>[lower_level, upper_level)</tt>. Bin \c i holds the samples \c s
+ *  for which <tt>(s - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt> rounds down to \c i.
+ *  Samples outside of <tt>[lower_level, upper_level)</tt> are not counted. The bins are the same as those of
+ *  <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *
+ *  The count of bin \c i is written to <tt>histogram[i]</tt>, overwriting what was there.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the counts of the bins.
+ *  \param num_levels The number of boundaries of the bins, one more than the number of bins.
+ *  \param lower_level The lower boundary of the first bin, which is inclusive.
+ *  \param upper_level The upper boundary of the last bin, which is exclusive.
+ *  \return The end of the counts of the bins, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator's \c value_type is an arithmetic type which converts to the common type of
+ *          itself and \c Level.
+ *  \tparam OutputIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OutputIterator's \c value_type is an arithmetic type the counts are converted to.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count samples in four bins using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[] = {2.2f, 6.5f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  int histogram[4];
+ *
+ *  // the bins are [0, 2), [2, 4), [4, 6) and [6, 8)
+ *  thrust::histogram_even(thrust::host, samples, samples + 10, histogram, 5, 0.0f, 8.0f);
+ *
+ *  // histogram is now {1, 5, 0, 3}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see <tt>cub::DeviceHistogram::HistogramEven</tt>
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> that fall into each of <tt>num_levels - 1</tt>
+ *  bins of equal width, which evenly divide <tt>[lower_level, upper_level)</tt>. Bin \c i holds the samples \c s
+ *  for which <tt>(s - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt> rounds down to \c i.
+ *  Samples outside of <tt>[lower_level, upper_level)</tt> are not counted. The bins are the same as those of
+ *  <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *
+ *  The count of bin \c i is written to <tt>histogram[i]</tt>, overwriting what was there.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the counts of the bins.
+ *  \param num_levels The number of boundaries of the bins, one more than the number of bins.
+ *  \param lower_level The lower boundary of the first bin, which is inclusive.
+ *  \param upper_level The upper boundary of the last bin, which is exclusive.
+ *  \return The end of the counts of the bins, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator's \c value_type is an arithmetic type which converts to the common type of
+ *          itself and \c Level.
+ *  \tparam OutputIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OutputIterator's \c value_type is an arithmetic type the counts are converted to.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count the bytes of a buffer by value.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<unsigned char> bytes = ...;
+ *  thrust::device_vector<unsigned int> histogram(256);
+ *
+ *  // one bin per value of a byte
+ *  thrust::histogram_even(bytes.begin(), bytes.end(), histogram.begin(), 257, 0, 256);
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see <tt>cub::DeviceHistogram::HistogramEven</tt>
+ */
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> that fall into each of the bins that the
+ *  ascending boundaries <tt>[levels_first, levels_last)</tt> delimit. Bin \c i holds the samples \c s for which
+ *  <tt>levels_first[i] <= s && s < levels_first[i + 1]</tt>. Samples outside of all bins are not counted. The bins
+ *  are the same as those of <tt>cub::DeviceHistogram::HistogramRange</tt>.
+ *
+ *  The count of bin \c i is written to <tt>histogram[i]</tt>, overwriting what was there.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the boundaries of the bins.
+ *  \param levels_last The end of the boundaries of the bins.
+ *  \param histogram The beginning of the counts of the bins.
+ *  \return The end of the counts of the bins, <tt>histogram + (levels_last - levels_first) - 1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator1's \c value_type is comparable with \c RandomAccessIterator2's
+ *          \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OutputIterator's \c value_type is an arithmetic type the counts are converted to.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count samples in bins of varying
+ *  width using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[] = {2.2f, 6.5f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  float levels[]  = {0.0f, 2.0f, 4.0f, 6.0f, 8.0f};
+ *  int histogram[4];
+ *
+ *  thrust::histogram_range(thrust::host, samples, samples + 10, levels, levels + 5, histogram);
+ *
+ *  // histogram is now {1, 5, 0, 3}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see <tt>cub::DeviceHistogram::HistogramRange</tt>
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram);
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> that fall into each of the bins that the
+ *  ascending boundaries <tt>[levels_first, levels_last)</tt> delimit. Bin \c i holds the samples \c s for which
+ *  <tt>levels_first[i] <= s && s < levels_first[i + 1]</tt>. Samples outside of all bins are not counted. The bins
+ *  are the same as those of <tt>cub::DeviceHistogram::HistogramRange</tt>.
+ *
+ *  The count of bin \c i is written to <tt>histogram[i]</tt>, overwriting what was there.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the boundaries of the bins.
+ *  \param levels_last The end of the boundaries of the bins.
+ *  \param histogram The beginning of the counts of the bins.
+ *  \return The end of the counts of the bins, <tt>histogram + (levels_last - levels_first) - 1</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c RandomAccessIterator1's \c value_type is comparable with \c RandomAccessIterator2's
+ *          \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OutputIterator's \c value_type is an arithmetic type the counts are converted to.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count samples in bins of varying
+ *  width.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<int> latencies = ...;
+ *  thrust::device_vector<int> levels    = ...; // e.g. {0, 1, 2, 4, 8, 16, 32}
+ *  thrust::device_vector<int> histogram(levels.size() - 1);
+ *
+ *  thrust::histogram_range(latencies.begin(), latencies.end(), levels.begin(), levels.end(), histogram.begin());
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see <tt>cub::DeviceHistogram::HistogramRange</tt>
+ */
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator histogram_range(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram);
+
+/*! \} // end histograms
+ *  \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
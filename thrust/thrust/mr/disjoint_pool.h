@@ -33,17 +33,20 @@
 
 #include <thrust/detail/config.h>
 
-#include <thrust/binary_search.h>
 #include <thrust/detail/algorithm_wrapper.h>
-#include <thrust/detail/seq.h>
 #include <thrust/host_vector.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
 
 #include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
 
 #include <cassert>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -168,6 +171,11 @@ private:
   using void_ptr = typename Upstream::pointer;
   using char_ptr = typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other;
 
+  // the bookkeeping is kept in standard containers and in host_vectors accessed through plain references, neither of
+  // which works with memory behind fancy pointers
+  static_assert(::cuda::std::is_pointer<typename Bookkeeper::pointer>::value,
+                "the bookkeeper of a disjoint pool resource must be a memory resource with raw pointers");
+
   struct chunk_descriptor
   {
     std::size_t size;
@@ -186,47 +194,35 @@ private:
     {
       return size == other.size && alignment == other.alignment && pointer == other.pointer;
     }
-
-    _CCCL_HOST_DEVICE bool operator<(const oversized_block_descriptor& other) const
-    {
-      return size < other.size || (size == other.size && alignment < other.alignment);
-    }
   };
 
-  struct equal_pointers
+  // pointers are hashed by the address they point to; pointers that compare
+  // unequal may still share it, for instance when the upstream memory isn't
+  // host-accessible and its pointers are handles
+  struct pointer_hash
   {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
+    std::size_t operator()(const void_ptr& p) const
     {
-      return desc.pointer == p;
+      return std::hash<const void*>()(detail::pointer_traits<void_ptr>::get(p));
     }
-
-  private:
-    void_ptr p;
   };
 
-  struct matching_alignment
-  {
-  public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
-        : requested(requested)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.alignment >= requested;
-    }
+  using oversized_block_map =
+    std::unordered_map<void_ptr,
+                       oversized_block_descriptor,
+                       pointer_hash,
+                       std::equal_to<void_ptr>,
+                       allocator<std::pair<const void_ptr, oversized_block_descriptor>, Bookkeeper>>;
 
-  private:
-    std::size_t requested;
-  };
+  // cached blocks are ordered by alignment first and size second, so that the
+  // blocks of every alignment form a range ordered by size
+  using cache_key = std::pair<std::size_t, std::size_t>;
 
-  using oversized_block_vector =
-    thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
+  using oversized_block_cache =
+    std::multimap<cache_key,
+                  void_ptr,
+                  std::less<cache_key>,
+                  allocator<std::pair<const cache_key, void_ptr>, Bookkeeper>>;
 
   using pointer_vector = thrust::host_vector<void_ptr, allocator<void_ptr, Bookkeeper>>;
 
@@ -263,10 +259,10 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
-  oversized_block_vector m_oversized;
+  // all cached oversized/overaligned blocks that have been returned to the pool to cache
+  oversized_block_cache m_cached_oversized;
+  // all oversized/overaligned allocations from upstream, by pointer
+  oversized_block_map m_oversized;
 
 public:
   /*! Releases all held memory to upstream.
@@ -287,9 +283,9 @@ public:
     }
 
     // deallocate cached oversized/overaligned memory
-    for (std::size_t i = 0; i < m_oversized.size(); ++i)
+    for (typename oversized_block_map::iterator it = m_oversized.begin(); it != m_oversized.end(); ++it)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      m_upstream->do_deallocate(it->second.pointer, it->second.size, it->second.alignment);
     }
 
     m_allocated.clear();
@@ -312,49 +308,53 @@ public:
 
       if (m_options.cache_oversized && !m_cached_oversized.empty())
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        typename oversized_block_cache::iterator best = m_cached_oversized.end();
+
+        // the smallest sufficiently large block of every alignment is found by
+        // a lower bound in its range, skipping the alignments with no blocks;
+        // if the alignment is bigger than the requested one by a factor bigger
+        // than or equal to the specified cutoff for alignment, the block is not
+        // considered
+        std::size_t block_alignment = alignment;
+        while (block_alignment != 0 && block_alignment / alignment < m_options.cached_alignment_cutoff_factor)
         {
-          std::size_t size_factor = (*it).size / bytes;
-          if (size_factor >= m_options.cached_size_cutoff_factor)
+          typename oversized_block_cache::iterator it =
+            m_cached_oversized.lower_bound(cache_key(block_alignment, bytes));
+
+          if (it == m_cached_oversized.end())
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
+          if (it->first.first != block_alignment)
+          {
+            block_alignment = it->first.first;
+            continue;
+          }
 
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
-          std::size_t alignment_factor = (*it).alignment / alignment;
-          if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+          // if the size is bigger than the requested size by a factor
+          // bigger than or equal to the specified cutoff for size,
+          // the block is not considered either
+          if (it->first.second / bytes < m_options.cached_size_cutoff_factor
+              && (best == m_cached_oversized.end() || it->first.second < best->first.second))
           {
-            it = m_cached_oversized.end();
+            best = it;
           }
+
+          block_alignment *= 2;
         }
 
-        if (it != m_cached_oversized.end())
+        if (best != m_cached_oversized.end())
         {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
+          oversized.pointer = best->second;
+          m_cached_oversized.erase(best);
           return oversized.pointer;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      m_oversized.emplace(oversized.pointer, oversized);
 
       return oversized.pointer;
     }
@@ -429,16 +429,14 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
+      typename oversized_block_map::iterator it = m_oversized.find(p);
       assert(it != m_oversized.end());
 
-      oversized_block_descriptor oversized = *it;
+      oversized_block_descriptor oversized = it->second;
 
       if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        m_cached_oversized.emplace(cache_key(oversized.alignment, oversized.size), oversized.pointer);
         return;
       }
 
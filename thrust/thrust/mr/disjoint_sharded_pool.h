@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file
+ *  \brief A thread-safe version of \p disjoint_unsynchronized_pool_resource, which caches free blocks in shards
+ *      selected by the calling thread in front of a mutex-synchronized central pool.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/sharded_pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe version of \p disjoint_unsynchronized_pool_resource that scales with the number of allocating
+ *      threads, in the same way as \p sharded_pool_resource. The caches of the shards are kept in host memory, so the
+ *      memory handed off to the user is never accessed by the pool.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the
+ *      user
+ *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template <typename Upstream, typename Bookkeeper>
+struct disjoint_sharded_pool_resource
+    : public detail::sharded_pool_resource_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>
+{
+private:
+  using base = detail::sharded_pool_resource_base<disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>>;
+
+public:
+  /*! Get the default options for a disjoint pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param bookkeeper the upstream memory resource for bookkeeping
+   *  \param options pool options to use
+   *  \param shard_count the number of shards to cache free blocks in; must be a power of two
+   */
+  disjoint_sharded_pool_resource(Upstream* upstream,
+                                 Bookkeeper* bookkeeper,
+                                 pool_options options    = get_default_options(),
+                                 std::size_t shard_count = base::get_default_shard_count())
+      : base(shard_count, options, upstream, bookkeeper)
+  {}
+
+  /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+   *
+   *  \param options pool options to use
+   */
+  disjoint_sharded_pool_resource(pool_options options = get_default_options())
+      : base(base::get_default_shard_count(),
+             options,
+             get_global_resource<Upstream>(),
+             get_global_resource<Bookkeeper>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
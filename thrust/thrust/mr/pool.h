@@ -38,6 +38,7 @@
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
 
+#include <cuda/std/bit>
 #include <cuda/std/cstdint>
 
 #include <cassert>
@@ -118,6 +119,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bins()
   {
     assert(m_options.validate());
 
@@ -139,6 +141,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bins()
   {
     assert(m_options.validate());
 
@@ -180,8 +183,8 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list (the cached lists are still forward lists, because
+  // allocation from them only ever unlinks a block it has reached by traversal)
   //
   // TODO: investigate whether it's better to have this be a doubly-linked list
   // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -213,10 +216,144 @@ private:
   pool_options m_options;
   std::size_t m_smallest_block_log2;
 
+  // cached oversized blocks are kept in segregated lists: every power of two of
+  // sizes is split into 2^oversized_sub_bin_bits bins of equal width, so that
+  // all blocks in a bin are within 25% of each other in size; every list is
+  // sorted by size, most recently cached first among blocks of the same size
+  static const std::size_t oversized_sub_bin_bits = 2;
+  static const std::size_t oversized_bin_count    = (8 * sizeof(std::size_t)) << oversized_sub_bin_bits;
+
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  oversized_block_descriptor_ptr m_cached_oversized[oversized_bin_count];
+  // bit i is set if the i-th list of cached oversized blocks is not empty
+  std::uint64_t m_cached_oversized_bins[oversized_bin_count / 64];
+
+  // the bin of cached blocks of the given size
+  static std::size_t oversized_bin(std::size_t size)
+  {
+    const std::size_t size_log2 = ::cuda::std::bit_width(size) - 1;
+    const std::size_t sub_bin =
+      size_log2 >= oversized_sub_bin_bits
+        ? size >> (size_log2 - oversized_sub_bin_bits)
+        : size << (oversized_sub_bin_bits - size_log2);
+
+    return (size_log2 << oversized_sub_bin_bits) | (sub_bin & ((std::size_t(1) << oversized_sub_bin_bits) - 1));
+  }
+
+  // the smallest size of a block in the given bin
+  static std::size_t oversized_bin_size(std::size_t bin)
+  {
+    const std::size_t size_log2 = bin >> oversized_sub_bin_bits;
+    const std::size_t sub_bin   = bin & ((std::size_t(1) << oversized_sub_bin_bits) - 1);
+    const std::size_t mantissa  = (std::size_t(1) << oversized_sub_bin_bits) | sub_bin;
+
+    return size_log2 >= oversized_sub_bin_bits
+           ? mantissa << (size_log2 - oversized_sub_bin_bits)
+           : mantissa >> (oversized_sub_bin_bits - size_log2);
+  }
+
+  // the first non-empty bin at or after the given one, or oversized_bin_count
+  std::size_t next_cached_oversized_bin(std::size_t bin) const
+  {
+    while (bin < oversized_bin_count)
+    {
+      const std::uint64_t word = m_cached_oversized_bins[bin / 64] >> (bin % 64);
+
+      if (word)
+      {
+        return bin + ::cuda::std::countr_zero(word);
+      }
+
+      bin = (bin / 64 + 1) * 64;
+    }
+
+    return oversized_bin_count;
+  }
+
+  bool is_good_oversized(const oversized_block_descriptor& desc, std::size_t bytes, std::size_t alignment) const
+  {
+    // if the size or the alignment is bigger than the requested one by a
+    // factor bigger than or equal to the specified cutoff, the block is not
+    // used and a new one is allocated
+    return desc.size >= bytes && desc.alignment >= alignment
+        && desc.size / bytes < m_options.cached_size_cutoff_factor
+        && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor;
+  }
+
+  // unlinks and returns the smallest block of the bin which can serve the
+  // request
+  oversized_block_descriptor_ptr take_cached_oversized(std::size_t bin, std::size_t bytes, std::size_t alignment)
+  {
+    oversized_block_descriptor_ptr ptr       = m_cached_oversized[bin];
+    oversized_block_descriptor_ptr* previous = &m_cached_oversized[bin];
+
+    while (oversized_block_ptr_traits::get(ptr))
+    {
+      oversized_block_descriptor desc = *ptr;
+
+      if (is_good_oversized(desc, bytes, alignment))
+      {
+        *previous = desc.next_cached;
+
+        if (!oversized_block_ptr_traits::get(m_cached_oversized[bin]))
+        {
+          m_cached_oversized_bins[bin / 64] &= ~(std::uint64_t(1) << (bin % 64));
+        }
+
+        return ptr;
+      }
+
+      // all further blocks of the bin are even larger
+      if (desc.size >= bytes && desc.size / bytes >= m_options.cached_size_cutoff_factor)
+      {
+        break;
+      }
+
+      previous = &thrust::raw_reference_cast(*ptr).next_cached;
+      ptr      = *previous;
+    }
+
+    return oversized_block_descriptor_ptr();
+  }
+
+  // unlinks and returns a cached block which can serve the request, or returns
+  // a null pointer if there is none
+  oversized_block_descriptor_ptr take_cached_oversized(std::size_t bytes, std::size_t alignment)
+  {
+    // the bin of the requested size also holds smaller blocks, which come
+    // first in it and are skipped
+    const std::size_t own_bin = oversized_bin(bytes);
+
+    oversized_block_descriptor_ptr ptr = take_cached_oversized(own_bin, bytes, alignment);
+
+    if (oversized_block_ptr_traits::get(ptr))
+    {
+      return ptr;
+    }
+
+    // the first non-empty larger bin has the best fitting blocks; the blocks
+    // are only passed over for their alignment, so the first one mostly fits
+    for (std::size_t bin = next_cached_oversized_bin(own_bin + 1); bin < oversized_bin_count;
+         bin             = next_cached_oversized_bin(bin + 1))
+    {
+      // all further bins hold even larger blocks
+      if (oversized_bin_size(bin) / bytes >= m_options.cached_size_cutoff_factor)
+      {
+        break;
+      }
+
+      ptr = take_cached_oversized(bin, bytes, alignment);
+
+      if (oversized_block_ptr_traits::get(ptr))
+      {
+        return ptr;
+      }
+    }
+
+    return oversized_block_descriptor_ptr();
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -254,7 +391,15 @@ public:
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    for (std::size_t i = 0; i < oversized_bin_count; ++i)
+    {
+      m_cached_oversized[i] = oversized_block_descriptor_ptr();
+    }
+
+    for (std::size_t i = 0; i < oversized_bin_count / 64; ++i)
+    {
+      m_cached_oversized_bins[i] = 0;
+    }
   }
 
   [[nodiscard]] virtual void_ptr
@@ -268,80 +413,39 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        oversized_block_descriptor_ptr ptr = take_cached_oversized(bytes, alignment);
+
+        if (oversized_block_ptr_traits::get(ptr))
         {
           oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          desc.next_cached                = oversized_block_descriptor_ptr();
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          if (bytes != desc.size)
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            desc.current_size = bytes;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (oversized_block_ptr_traits::get(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
-
-            *ptr = desc;
-
-            return static_cast<void_ptr>(ret);
           }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          *ptr = desc;
+
+          return static_cast<void_ptr>(ret);
         }
       }
 
@@ -457,7 +561,18 @@ public:
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
+        const std::size_t bin = oversized_bin(desc.size);
+
+        // keep the bin sorted by size, so that the first block which serves a
+        // request is also the best fitting one
+        oversized_block_descriptor_ptr* previous = &m_cached_oversized[bin];
+
+        while (oversized_block_ptr_traits::get(*previous) && thrust::raw_reference_cast(**previous).size < desc.size)
+        {
+          previous = &thrust::raw_reference_cast(**previous).next_cached;
+        }
+
+        desc.next_cached = *previous;
 
         if (desc.size != n)
         {
@@ -479,8 +594,9 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        *previous = block;
+        m_cached_oversized_bins[bin / 64] |= std::uint64_t(1) << (bin % 64);
+        *block = desc;
 
         return;
       }
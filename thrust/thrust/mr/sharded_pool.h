@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file
+ *  \brief A thread-safe version of \p unsynchronized_pool_resource, which caches free blocks in shards selected by the
+ *      calling thread in front of a mutex-synchronized central pool.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/mr/pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+namespace detail
+{
+
+// Numbers the threads that allocate from any sharded pool in the order in which they first do so, so that up to as
+// many threads as there are shards each get a shard of their own.
+inline std::size_t sharded_pool_thread_index()
+{
+  static std::atomic<std::size_t> next_index{0};
+  static thread_local const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+/*! The implementation of the sharded pool resources, parameterized on the pool used as the central pool.
+ *
+ *  Requests that the central pool would serve from one of its buckets are served from a cache of free blocks of the
+ *  same size, kept per shard. Each shard has its own mutex, so threads that map to different shards never contend.
+ *  Caches are refilled from, and trimmed back to, the central pool a batch of blocks at a time. Oversized and
+ *  overaligned requests go straight to the central pool.
+ *
+ *  All the blocks of a size class are interchangeable, so a block can be deallocated by a different thread than the
+ *  one that allocated it; it goes to the cache of the deallocating thread, and from there back to the central pool
+ *  once that cache holds more than two batches of blocks.
+ */
+template <typename CentralPool>
+class sharded_pool_resource_base : public memory_resource<typename CentralPool::pointer>
+{
+  using void_ptr = typename CentralPool::pointer;
+  using lock_t   = std::lock_guard<std::mutex>;
+
+  // XXX the number of bytes moved between a cache and the central pool at once is a tuning opportunity
+  static constexpr std::size_t batch_bytes = static_cast<std::size_t>(1) << 16;
+
+  static constexpr std::size_t max_batch_blocks = 32;
+
+  // XXX 64 is the usual size of a cache line
+  struct alignas(64) shard
+  {
+    std::mutex mtx;
+    // one stack of free blocks per size class
+    std::vector<std::vector<void_ptr>> free_blocks;
+  };
+
+public:
+  /*! The number of shards used when none is given; the hardware concurrency rounded up to a power of two, at most 64.
+   */
+  static std::size_t get_default_shard_count()
+  {
+    const std::size_t hardware = (std::max)(1u, std::thread::hardware_concurrency());
+    return (std::min)(static_cast<std::size_t>(1) << thrust::detail::log2_ri(hardware), static_cast<std::size_t>(64));
+  }
+
+  /*! Releases the memory cached in every shard and then all memory held by the central pool to upstream.
+   */
+  void release()
+  {
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      shard& s = m_shards[i];
+      lock_t shard_lock(s.mtx);
+      lock_t central_lock(m_central_mtx);
+      for (std::size_t size_class = 0; size_class < s.free_blocks.size(); ++size_class)
+      {
+        std::vector<void_ptr>& blocks = s.free_blocks[size_class];
+        return_blocks(blocks, blocks.size(), size_class);
+      }
+    }
+
+    lock_t central_lock(m_central_mtx);
+    m_central.release();
+  }
+
+  [[nodiscard]] virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+    assert(thrust::detail::is_power_of_2(alignment));
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t central_lock(m_central_mtx);
+      return m_central.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t size_class = thrust::detail::log2_ri(bytes) - m_smallest_block_log2;
+
+    shard& s = current_shard();
+    lock_t shard_lock(s.mtx);
+    std::vector<void_ptr>& blocks = s.free_blocks[size_class];
+
+    if (blocks.empty())
+    {
+      const std::size_t block_size = class_block_size(size_class);
+      const std::size_t batch      = batch_blocks(size_class);
+
+      blocks.reserve(2 * batch + 1);
+
+      lock_t central_lock(m_central_mtx);
+      for (std::size_t i = 0; i < batch; ++i)
+      {
+        blocks.push_back(m_central.do_allocate(block_size, m_options.alignment));
+      }
+    }
+
+    void_ptr ret = blocks.back();
+    blocks.pop_back();
+    return ret;
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+    assert(thrust::detail::is_power_of_2(alignment));
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t central_lock(m_central_mtx);
+      m_central.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t size_class = thrust::detail::log2_ri(n) - m_smallest_block_log2;
+
+    shard& s = current_shard();
+    lock_t shard_lock(s.mtx);
+    std::vector<void_ptr>& blocks = s.free_blocks[size_class];
+
+    blocks.push_back(p);
+
+    // keep one batch around, so that a thread that keeps allocating and deallocating one block at the boundary
+    // does not go to the central pool every time
+    const std::size_t batch = batch_blocks(size_class);
+    if (blocks.size() > 2 * batch)
+    {
+      lock_t central_lock(m_central_mtx);
+      return_blocks(blocks, batch, size_class);
+    }
+  }
+
+protected:
+  template <typename... Args>
+  sharded_pool_resource_base(std::size_t shard_count, pool_options options, Args&&... args)
+      : m_options(options)
+      , m_smallest_block_log2(thrust::detail::log2_ri(options.smallest_block_size))
+      , m_shard_count(shard_count)
+      , m_shards(new shard[shard_count])
+      , m_central(std::forward<Args>(args)..., options)
+  {
+    assert(shard_count > 0 && thrust::detail::is_power_of_2(shard_count));
+
+    const std::size_t size_classes =
+      thrust::detail::log2_ri(options.largest_block_size) - m_smallest_block_log2 + 1;
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      m_shards[i].free_blocks.resize(size_classes);
+    }
+  }
+
+private:
+  shard& current_shard()
+  {
+    return m_shards[sharded_pool_thread_index() & (m_shard_count - 1)];
+  }
+
+  std::size_t class_block_size(std::size_t size_class) const
+  {
+    return static_cast<std::size_t>(1) << (size_class + m_smallest_block_log2);
+  }
+
+  std::size_t batch_blocks(std::size_t size_class) const
+  {
+    const std::size_t blocks = batch_bytes >> (size_class + m_smallest_block_log2);
+    return (std::max)(static_cast<std::size_t>(1), (std::min)(blocks, max_batch_blocks));
+  }
+
+  // returns the oldest blocks of a cache to the central pool; the central mutex must be held
+  void return_blocks(std::vector<void_ptr>& blocks, std::size_t count, std::size_t size_class)
+  {
+    const std::size_t block_size = class_block_size(size_class);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      m_central.do_deallocate(blocks[i], block_size, m_options.alignment);
+    }
+    blocks.erase(blocks.begin(), blocks.begin() + count);
+  }
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+
+  std::size_t m_shard_count;
+  std::unique_ptr<shard[]> m_shards;
+
+  std::mutex m_central_mtx;
+  CentralPool m_central;
+};
+
+} // namespace detail
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe version of \p unsynchronized_pool_resource that scales with the number of allocating threads.
+ *      Unlike \p synchronized_pool_resource, which serializes every allocation on one mutex, it caches free blocks in
+ *      shards selected by the calling thread, and only goes to the shared pool to move batches of blocks. Blocks may
+ *      be deallocated by any thread.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+struct sharded_pool_resource : public detail::sharded_pool_resource_base<unsynchronized_pool_resource<Upstream>>
+{
+private:
+  using base = detail::sharded_pool_resource_base<unsynchronized_pool_resource<Upstream>>;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsynchronized_pool_resource<Upstream>::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   *  \param shard_count the number of shards to cache free blocks in; must be a power of two
+   */
+  sharded_pool_resource(Upstream* upstream,
+                        pool_options options    = get_default_options(),
+                        std::size_t shard_count = base::get_default_shard_count())
+      : base(shard_count, options, upstream)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(pool_options options = get_default_options())
+      : base(base::get_default_shard_count(), options, get_global_resource<Upstream>())
+  {}
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
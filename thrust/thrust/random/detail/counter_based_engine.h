@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file counter_based_engine.h
+ *  \brief Word arithmetic shared by the counter-based random number engines.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/array>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <nv/target>
+
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// The w low bits of a UIntType set
+template <typename UIntType, size_t w>
+_CCCL_HOST_DEVICE constexpr UIntType counter_based_engine_wordmask()
+{
+  return w == ::cuda::std::numeric_limits<UIntType>::digits ? ~UIntType(0) : (UIntType(1) << w) - 1;
+}
+
+// The high and low w bits of the 2w bit product of two w bit words
+template <size_t w, typename UIntType>
+_CCCL_HOST_DEVICE UIntType mulhilo(UIntType a, UIntType b, UIntType& hi)
+{
+  static_assert(w <= 64, "words of at most 64 bits are supported");
+
+  if constexpr (w <= 32)
+  {
+    const ::cuda::std::uint64_t product = ::cuda::std::uint64_t(a) * ::cuda::std::uint64_t(b);
+    hi                                  = UIntType(product >> w);
+    return UIntType(product) & counter_based_engine_wordmask<UIntType, w>();
+  }
+  else
+  {
+    const ::cuda::std::uint64_t x = a;
+    const ::cuda::std::uint64_t y = b;
+#if _CCCL_HAS_INT128()
+    const __uint128_t product              = __uint128_t(x) * y;
+    const ::cuda::std::uint64_t product_hi = ::cuda::std::uint64_t(product >> 64);
+#else // ^^^ _CCCL_HAS_INT128() ^^^ / vvv !_CCCL_HAS_INT128() vvv
+    ::cuda::std::uint64_t product_hi;
+    NV_IF_TARGET(NV_IS_DEVICE,
+                 (product_hi = __umul64hi(x, y);),
+                 (const ::cuda::std::uint64_t x_lo = x & 0xffffffffu; const ::cuda::std::uint64_t x_hi = x >> 32;
+                  const ::cuda::std::uint64_t y_lo = y & 0xffffffffu; const ::cuda::std::uint64_t y_hi = y >> 32;
+                  const ::cuda::std::uint64_t lo_lo = x_lo * y_lo; const ::cuda::std::uint64_t hi_lo = x_hi * y_lo;
+                  const ::cuda::std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + x_lo * y_hi;
+                  product_hi = (hi_lo >> 32) + (cross >> 32) + x_hi * y_hi;));
+#endif // !_CCCL_HAS_INT128()
+    if constexpr (w == 64)
+    {
+      hi = UIntType(product_hi);
+      return UIntType(x * y);
+    }
+    else
+    {
+      const ::cuda::std::uint64_t product_lo = x * y;
+      hi = UIntType(((product_hi << (64 - w)) | (product_lo >> w)) & counter_based_engine_wordmask<UIntType, w>());
+      return UIntType(product_lo) & counter_based_engine_wordmask<UIntType, w>();
+    }
+  }
+}
+
+// Rotates a w bit word left
+template <size_t w, typename UIntType>
+_CCCL_HOST_DEVICE UIntType rotl(UIntType x, unsigned int r)
+{
+  return ((x << r) | (x >> ((w - r) % w))) & counter_based_engine_wordmask<UIntType, w>();
+}
+
+// Adds z to a multi-word counter of w bit words, the first one being the least significant
+template <size_t w, typename UIntType, size_t n>
+_CCCL_HOST_DEVICE void counter_add(::cuda::std::array<UIntType, n>& counter, unsigned long long z)
+{
+  constexpr UIntType mask = counter_based_engine_wordmask<UIntType, w>();
+
+  for (size_t i = 0; i < n && z != 0; ++i)
+  {
+    const UIntType sum = (counter[i] + UIntType(z & mask)) & mask;
+    // the carry out of this word is one if the sum wrapped around
+    const unsigned long long carry = sum < counter[i] ? 1 : 0;
+    counter[i]                     = sum;
+    if constexpr (w < 64)
+    {
+      z >>= w;
+    }
+    else
+    {
+      z = 0;
+    }
+    z += carry;
+  }
+}
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
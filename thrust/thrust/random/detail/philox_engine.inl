@@ -0,0 +1,300 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/philox_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE philox_engine<UIntType, w, n, r, consts...>::philox_engine(result_type s)
+{
+  seed(s);
+} // end philox_engine::philox_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE
+philox_engine<UIntType, w, n, r, consts...>::philox_engine(const key_type& key, const counter_type& counter)
+{
+  seed(key, counter);
+} // end philox_engine::philox_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::seed(result_type s)
+{
+  key_type key{};
+  key[0] = s;
+  seed(key);
+} // end philox_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void
+philox_engine<UIntType, w, n, r, consts...>::seed(const key_type& key, const counter_type& counter)
+{
+  for (size_t i = 0; i < n / 2; ++i)
+  {
+    m_k[i] = key[i] & max;
+  } // end for i
+
+  set_counter(counter);
+} // end philox_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::set_counter(const counter_type& counter)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    m_x[i] = counter[i] & max;
+    m_y[i] = 0;
+  } // end for i
+
+  // the (empty) current block has been used up
+  m_j = n - 1;
+} // end philox_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::counter_type
+philox_engine<UIntType, w, n, r, consts...>::get_counter() const
+{
+  return m_x;
+} // end philox_engine::get_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::counter_type
+philox_engine<UIntType, w, n, r, consts...>::generate_block(counter_type x) const
+{
+  // the multipliers and round constants alternate
+  const result_type c[n] = {consts...};
+
+  key_type k = m_k;
+
+  for (size_t q = 0; q < r; ++q)
+  {
+    // the words of a four word block are permuted before every round
+    counter_type v = x;
+    if constexpr (n == 4)
+    {
+      v[0] = x[2];
+      v[2] = x[0];
+    }
+
+    for (size_t i = 0; i < n / 2; ++i)
+    {
+      result_type hi;
+      const result_type lo = detail::mulhilo<w>(v[2 * i], c[2 * i], hi);
+      x[2 * i]             = hi ^ k[i] ^ v[2 * i + 1];
+      x[2 * i + 1]         = lo;
+    } // end for i
+
+    for (size_t i = 0; i < n / 2; ++i)
+    {
+      k[i] = (k[i] + c[2 * i + 1]) & max;
+    } // end for i
+  } // end for q
+
+  return x;
+} // end philox_engine::generate_block()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::result_type
+philox_engine<UIntType, w, n, r, consts...>::operator()(void)
+{
+  if (++m_j == n)
+  {
+    m_y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+    m_j = 0;
+  } // end if
+
+  return m_y[m_j];
+} // end philox_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename OutputIterator>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::generate(OutputIterator first, OutputIterator last)
+{
+  // finish the current block
+  for (; m_j != n - 1 && first != last; ++first)
+  {
+    *first = this->operator()();
+  } // end for
+
+  while (first != last)
+  {
+    const counter_type y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+
+    size_t i = 0;
+    for (; i < n && first != last; ++i, ++first)
+    {
+      *first = y[i];
+    } // end for i
+
+    if (i < n)
+    {
+      // keep the rest of the last block for the next invocation
+      m_y = y;
+      m_j = i - 1;
+    } // end if
+  } // end while
+} // end philox_engine::generate()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::discard(unsigned long long z)
+{
+  // the number of blocks to step over, and the index of the last value to discard in the last one
+  const unsigned long long blocks = z / n + (m_j + z % n) / n;
+  const size_t j                  = static_cast<size_t>((m_j + z % n) % n);
+
+  if (blocks == 0)
+  {
+    m_j = j;
+    return;
+  } // end if
+
+  if (j == n - 1)
+  {
+    // the last block is used up, so there is no need to generate it
+    detail::counter_add<w>(m_x, blocks);
+  } // end if
+  else
+  {
+    detail::counter_add<w>(m_x, blocks - 1);
+    m_y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+  } // end else
+
+  m_j = j;
+} // end philox_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the counter, the key, the current block and the index into it
+  for (size_t i = 0; i < n; ++i)
+  {
+    os << m_x[i] << space;
+  } // end for i
+
+  for (size_t i = 0; i < n / 2; ++i)
+  {
+    os << m_k[i] << space;
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    os << m_y[i] << space;
+  } // end for i
+
+  os << m_j;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the counter, the key, the current block and the index into it
+  for (size_t i = 0; i < n; ++i)
+  {
+    is >> m_x[i];
+  } // end for i
+
+  for (size_t i = 0; i < n / 2; ++i)
+  {
+    is >> m_k[i];
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    is >> m_y[i];
+  } // end for i
+
+  is >> m_j;
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool philox_engine<UIntType, w, n, r, consts...>::equal(const philox_engine& rhs) const
+{
+  // the current block is a function of the key and the counter
+  return m_x == rhs.m_x && m_k == rhs.m_k && m_j == rhs.m_j;
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,354 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/threefry_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// The rotation amounts of the rounds of Threefry, which repeat every eight rounds; a four word block is mixed as two
+// pairs, which rotate by different amounts
+template <size_t w, size_t n>
+_CCCL_HOST_DEVICE unsigned int threefry_rotation(size_t round, size_t pair)
+{
+  if constexpr (w == 32 && n == 2)
+  {
+    const unsigned int rotations[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+    (void) pair;
+    return rotations[round];
+  }
+  else if constexpr (w == 32)
+  {
+    const unsigned int rotations[8][2] = {
+      {10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}};
+    return rotations[round][pair];
+  }
+  else if constexpr (n == 2)
+  {
+    const unsigned int rotations[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    (void) pair;
+    return rotations[round];
+  }
+  else
+  {
+    const unsigned int rotations[8][2] = {
+      {14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    return rotations[round][pair];
+  }
+}
+
+// The constant that the parity word of the key schedule starts from
+template <size_t w, typename UIntType>
+_CCCL_HOST_DEVICE constexpr UIntType threefry_parity()
+{
+  return w == 32 ? UIntType(0x1BD11BDAu) : UIntType(0x1BD11BDAA9FC1A22ull);
+}
+
+} // namespace detail
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE threefry_engine<UIntType, w, n, r>::threefry_engine(result_type s)
+{
+  seed(s);
+} // end threefry_engine::threefry_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE
+threefry_engine<UIntType, w, n, r>::threefry_engine(const key_type& key, const counter_type& counter)
+{
+  seed(key, counter);
+} // end threefry_engine::threefry_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::seed(result_type s)
+{
+  key_type key{};
+  key[0] = s;
+  seed(key);
+} // end threefry_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void
+threefry_engine<UIntType, w, n, r>::seed(const key_type& key, const counter_type& counter)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    m_k[i] = key[i] & max;
+  } // end for i
+
+  set_counter(counter);
+} // end threefry_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::set_counter(const counter_type& counter)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    m_x[i] = counter[i] & max;
+    m_y[i] = 0;
+  } // end for i
+
+  // the (empty) current block has been used up
+  m_j = n - 1;
+} // end threefry_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::counter_type
+threefry_engine<UIntType, w, n, r>::get_counter() const
+{
+  return m_x;
+} // end threefry_engine::get_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::counter_type
+threefry_engine<UIntType, w, n, r>::generate_block(counter_type x) const
+{
+  // the key schedule is the key words followed by their parity
+  result_type ks[n + 1];
+  ks[n] = detail::threefry_parity<w, result_type>();
+  for (size_t i = 0; i < n; ++i)
+  {
+    ks[i] = m_k[i];
+    ks[n] ^= m_k[i];
+    x[i] = (x[i] + ks[i]) & max;
+  } // end for i
+
+  for (size_t q = 0; q < r; ++q)
+  {
+    if constexpr (n == 2)
+    {
+      x[0] = (x[0] + x[1]) & max;
+      x[1] = detail::rotl<w>(x[1], detail::threefry_rotation<w, n>(q % 8, 0)) ^ x[0];
+    }
+    else
+    {
+      // odd rounds mix the words crosswise
+      const size_t a = q % 2 == 0 ? 1 : 3;
+      const size_t b = q % 2 == 0 ? 3 : 1;
+      x[0]           = (x[0] + x[a]) & max;
+      x[a]           = detail::rotl<w>(x[a], detail::threefry_rotation<w, n>(q % 8, 0)) ^ x[0];
+      x[2]           = (x[2] + x[b]) & max;
+      x[b]           = detail::rotl<w>(x[b], detail::threefry_rotation<w, n>(q % 8, 1)) ^ x[2];
+    }
+
+    // inject the key every four rounds
+    if (q % 4 == 3)
+    {
+      const size_t s = (q + 1) / 4;
+      for (size_t i = 0; i < n; ++i)
+      {
+        x[i] = (x[i] + ks[(s + i) % (n + 1)]) & max;
+      } // end for i
+      x[n - 1] = (x[n - 1] + result_type(s)) & max;
+    } // end if
+  } // end for q
+
+  return x;
+} // end threefry_engine::generate_block()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::result_type
+threefry_engine<UIntType, w, n, r>::operator()(void)
+{
+  if (++m_j == n)
+  {
+    m_y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+    m_j = 0;
+  } // end if
+
+  return m_y[m_j];
+} // end threefry_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename OutputIterator>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::generate(OutputIterator first, OutputIterator last)
+{
+  // finish the current block
+  for (; m_j != n - 1 && first != last; ++first)
+  {
+    *first = this->operator()();
+  } // end for
+
+  while (first != last)
+  {
+    const counter_type y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+
+    size_t i = 0;
+    for (; i < n && first != last; ++i, ++first)
+    {
+      *first = y[i];
+    } // end for i
+
+    if (i < n)
+    {
+      // keep the rest of the last block for the next invocation
+      m_y = y;
+      m_j = i - 1;
+    } // end if
+  } // end while
+} // end threefry_engine::generate()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::discard(unsigned long long z)
+{
+  // the number of blocks to step over, and the index of the last value to discard in the last one
+  const unsigned long long blocks = z / n + (m_j + z % n) / n;
+  const size_t j                  = static_cast<size_t>((m_j + z % n) % n);
+
+  if (blocks == 0)
+  {
+    m_j = j;
+    return;
+  } // end if
+
+  if (j == n - 1)
+  {
+    // the last block is used up, so there is no need to generate it
+    detail::counter_add<w>(m_x, blocks);
+  } // end if
+  else
+  {
+    detail::counter_add<w>(m_x, blocks - 1);
+    m_y = generate_block(m_x);
+    detail::counter_add<w>(m_x, 1);
+  } // end else
+
+  m_j = j;
+} // end threefry_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the counter, the key, the current block and the index into it
+  for (size_t i = 0; i < n; ++i)
+  {
+    os << m_x[i] << space;
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    os << m_k[i] << space;
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    os << m_y[i] << space;
+  } // end for i
+
+  os << m_j;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the counter, the key, the current block and the index into it
+  for (size_t i = 0; i < n; ++i)
+  {
+    is >> m_x[i];
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    is >> m_k[i];
+  } // end for i
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    is >> m_y[i];
+  } // end for i
+
+  is >> m_j;
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool threefry_engine<UIntType, w, n, r>::equal(const threefry_engine& rhs) const
+{
+  // the current block is a function of the key and the counter
+  return m_x == rhs.m_x && m_k == rhs.m_k && m_j == rhs.m_j;
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+} // namespace random
+
+THRUST_NAMESPACE_END
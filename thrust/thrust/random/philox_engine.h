@@ -0,0 +1,310 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number engine built on the Philox bijection.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cuda/std/array>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer random numbers by
+ *         encrypting a counter with the Philox block cipher of Salmon et al., "Parallel Random
+ *         Numbers: As Easy as 1, 2, 3", SC11.
+ *
+ *         Each block of \p n values is the encryption of an \p n word counter under a key of
+ *         <tt>n / 2</tt> words, and the counter is incremented once per block. Because the values
+ *         of a block only depend on the key and the counter, \p discard takes constant time and
+ *         an engine can be positioned anywhere in its sequence by constructing it from a key and a
+ *         counter. This makes it suitable for parallel algorithms, in which each element can
+ *         construct its own engine from a shared key and its index as the counter, and produce the
+ *         same values regardless of the backend or the number of threads.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values; <tt>w <= numeric_limits<UIntType>::digits</tt>.
+ *  \tparam n The number of words of a block; \c 2 or \c 4.
+ *  \tparam r The number of rounds of the bijection.
+ *  \tparam consts The multipliers and round constants, in the order <tt>M0, C0, M1, C1</tt>.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p philox4x32 or \p philox4x64.
+ *
+ *  The following code snippet shows how to fill a range with the values of independent streams:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/iterator/counting_iterator.h>
+ *  #include <thrust/transform.h>
+ *  #include <thrust/execution_policy.h>
+ *
+ *  struct draw
+ *  {
+ *    __host__ __device__ unsigned int operator()(unsigned int i) const
+ *    {
+ *      // the i-th stream of the key 42
+ *      thrust::philox4x32 rng({42, 0}, {0, 0, i, 0});
+ *      return rng();
+ *    }
+ *  };
+ *
+ *  ...
+ *  thrust::transform(thrust::host, thrust::counting_iterator<unsigned int>(0),
+ *                    thrust::counting_iterator<unsigned int>(n), result.begin(), draw());
+ *  \endcode
+ *
+ *  \see thrust::random::philox4x32
+ *  \see thrust::random::philox4x64
+ */
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+class philox_engine
+{
+  static_assert(n == 2 || n == 4, "philox_engine supports blocks of 2 or 4 words");
+  static_assert(sizeof...(consts) == n, "philox_engine takes one multiplier and one round constant per word pair");
+  static_assert(w > 0 && w <= 64 && w <= ::cuda::std::numeric_limits<UIntType>::digits,
+                "the word size must be positive and fit in UIntType and in 64 bits");
+  static_assert(r > 0, "philox_engine needs at least one round");
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p philox_engine.
+   */
+  using result_type = UIntType;
+
+  /*! \typedef counter_type
+   *  \brief The type of a counter; its first word is the least significant one.
+   */
+  using counter_type = ::cuda::std::array<result_type, n>;
+
+  /*! \typedef key_type
+   *  \brief The type of a key.
+   */
+  using key_type = ::cuda::std::array<result_type, n / 2>;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words of a block.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the bijection.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p philox_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p philox_engine may potentially produce.
+   */
+  static const result_type max = detail::counter_based_engine_wordmask<result_type, w>();
+
+  /*! The default seed of this \p philox_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new \p philox_engine.
+   *
+   *  \param s The seed used to initialize this \p philox_engine's key; the counter starts at zero.
+   */
+  _CCCL_HOST_DEVICE explicit philox_engine(result_type s = default_seed);
+
+  /*! This constructor initializes a new \p philox_engine from a key and the counter of the
+   *  first block it produces.
+   *
+   *  \param key The key.
+   *  \param counter The counter of the first block.
+   */
+  _CCCL_HOST_DEVICE philox_engine(const key_type& key, const counter_type& counter = counter_type{});
+
+  /*! This method initializes this \p philox_engine's state, and optionally accepts a seed value.
+   *
+   *  \param s The seed used to initialize this \p philox_engine's key; the counter starts at zero.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type s = default_seed);
+
+  /*! This method initializes this \p philox_engine's state from a key and the counter of the
+   *  first block it produces.
+   *
+   *  \param key The key.
+   *  \param counter The counter of the first block.
+   */
+  _CCCL_HOST_DEVICE void seed(const key_type& key, const counter_type& counter = counter_type{});
+
+  /*! This method positions this \p philox_engine at the start of the block of a given counter,
+   *  keeping its key.
+   *
+   *  \param counter The counter of the next block.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const counter_type& counter);
+
+  /*! This method returns the counter of the next block that this \p philox_engine will generate.
+   *
+   *  \return The counter of the next block.
+   */
+  _CCCL_HOST_DEVICE counter_type get_counter() const;
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p philox_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function fills a range with the values that consecutive invocations of
+   *  \p operator() would produce. Whole blocks are written straight to the range.
+   *
+   *  \param first The beginning of the range to fill.
+   *  \param last The end of the range to fill.
+   */
+  template <typename OutputIterator>
+  _CCCL_HOST_DEVICE void generate(OutputIterator first, OutputIterator last);
+
+  /*! This member function advances this \p philox_engine's state a given number of times
+   *  and discards the results. It takes constant time.
+   *
+   *  \param z The number of random values to discard.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  // encrypts a counter under the key of this engine
+  _CCCL_HOST_DEVICE counter_type generate_block(counter_type x) const;
+
+  friend struct thrust::random::detail::random_core_access;
+
+  _CCCL_HOST_DEVICE bool equal(const philox_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  // the counter of the next block
+  counter_type m_x;
+  key_type m_k;
+  // the current block, and the index of the last value of it that was returned
+  counter_type m_y;
+  size_t m_j;
+
+  /*! \endcond
+   */
+}; // end philox_engine
+
+/*! This function checks two \p philox_engines for equality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function checks two \p philox_engines for inequality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function streams a philox_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p philox_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! This function streams a philox_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p philox_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! \} // random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x32-10 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+using philox4x32 = philox_engine<std::uint32_t, 32, 4, 10, 0xCD9E8D57, 0x9E3779B9, 0xD2511F53, 0xBB67AE85>;
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x64-10 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+using philox4x64 = philox_engine<std::uint64_t,
+                                 64,
+                                 4,
+                                 10,
+                                 0xCA5A826395121157,
+                                 0x9E3779B97F4A7C15,
+                                 0xD2E7470EE14C6C93,
+                                 0xBB67AE8584CAA73B>;
+
+/*! \} // predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::philox4x32;
+using random::philox4x64;
+using random::philox_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/philox_engine.inl>
@@ -0,0 +1,562 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file segmented_sort.h
+ *  \brief Sorts the elements of each of a sequence of segments of a range independently
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p segmented_sort sorts the elements of each segment of <tt>[first, last)</tt> into ascending order, independently
+ *  of the other segments. Segment \c i is <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>,
+ *  for every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater
+ *  than its begin offset is empty. The segments must not overlap, but they need not be contiguous, and the elements
+ *  outside of every segment are left unchanged. The segments are the same as those of
+ *  <tt>cub::DeviceSegmentedSort::SortKeys</tt>.
+ *
+ *  As with \p sort, the relative order of equivalent elements of a segment is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range the segments are in.
+ *  \param last The end of the range the segments are in.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator is mutable, and \c RandomAccessIterator's \c value_type is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort three contiguous segments using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[]    = {8, 6, 7, 5, 3, 0, 9};
+ *  int offsets[] = {0, 3, 3, 7};
+ *
+ *  // the segments are [0, 3), [3, 3) and [3, 7)
+ *  thrust::segmented_sort(thrust::host, keys, keys + 7, offsets, offsets + 3, offsets + 1);
+ *
+ *  // keys is now {6, 7, 8, 0, 3, 5, 9}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ *  \see <tt>cub::DeviceSegmentedSort::SortKeys</tt>
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort sorts the elements of each segment of <tt>[first, last)</tt> into ascending order, independently
+ *  of the other segments. Segment \c i is <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>,
+ *  for every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater
+ *  than its begin offset is empty. The segments must not overlap, but they need not be contiguous, and the elements
+ *  outside of every segment are left unchanged. The segments are the same as those of
+ *  <tt>cub::DeviceSegmentedSort::SortKeys</tt>.
+ *
+ *  As with \p sort, the relative order of equivalent elements of a segment is not guaranteed to be preserved.
+ *
+ *  \param first The beginning of the range the segments are in.
+ *  \param last The end of the range the segments are in.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator is mutable, and \c RandomAccessIterator's \c value_type is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort two segments with a gap between them.
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  ...
+ *  int keys[]          = {8, 6, 7, 5, 3, 0, 9};
+ *  int begin_offsets[] = {0, 4};
+ *  int end_offsets[]   = {2, 7};
+ *
+ *  // the segments are [0, 2) and [4, 7)
+ *  thrust::segmented_sort(keys, keys + 7, begin_offsets, begin_offsets + 2, end_offsets);
+ *
+ *  // keys is now {6, 8, 7, 5, 0, 3, 9}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ *  \see <tt>cub::DeviceSegmentedSort::SortKeys</tt>
+ */
+template <typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+void segmented_sort(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort sorts the elements of each segment of <tt>[first, last)</tt> into ascending order according to
+ *  the function object \p comp, independently of the other segments. Segment \c i is
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>, for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater than its begin
+ *  offset is empty. The segments must not overlap, but they need not be contiguous, and the elements outside of
+ *  every segment are left unchanged.
+ *
+ *  As with \p sort, the relative order of equivalent elements of a segment is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range the segments are in.
+ *  \param last The end of the range the segments are in.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator is mutable, and \c RandomAccessIterator's \c value_type is convertible to
+ *          \p StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort two segments into descending order
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[]    = {8, 6, 7, 5, 3, 0, 9};
+ *  int offsets[] = {0, 3, 7};
+ *
+ *  thrust::segmented_sort(thrust::host, keys, keys + 7, offsets, offsets + 2, offsets + 1, thrust::greater<int>());
+ *
+ *  // keys is now {8, 7, 6, 9, 5, 3, 0}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ *  \see <tt>cub::DeviceSegmentedSort::SortKeysDescending</tt>
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts the elements of each segment of <tt>[first, last)</tt> into ascending order according to
+ *  the function object \p comp, independently of the other segments. Segment \c i is
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>, for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater than its begin
+ *  offset is empty. The segments must not overlap, but they need not be contiguous, and the elements outside of
+ *  every segment are left unchanged.
+ *
+ *  As with \p sort, the relative order of equivalent elements of a segment is not guaranteed to be preserved.
+ *
+ *  \param first The beginning of the range the segments are in.
+ *  \param last The end of the range the segments are in.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator is mutable, and \c RandomAccessIterator's \c value_type is convertible to
+ *          \p StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort two segments into descending order.
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int keys[]    = {8, 6, 7, 5, 3, 0, 9};
+ *  int offsets[] = {0, 3, 7};
+ *
+ *  thrust::segmented_sort(keys, keys + 7, offsets, offsets + 2, offsets + 1, thrust::greater<int>());
+ *
+ *  // keys is now {8, 7, 6, 9, 5, 3, 0}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_sort_by_key
+ *  \see <tt>cub::DeviceSegmentedSort::SortKeysDescending</tt>
+ */
+template <typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key sorts the keys of each segment of <tt>[keys_first, keys_last)</tt> into ascending order,
+ *  independently of the other segments, and permutes the values of the segment starting at \p values_first
+ *  alongside them. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>,
+ *  for every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater
+ *  than its begin offset is empty. The segments must not overlap, but they need not be contiguous, and the keys and
+ *  values outside of every segment are left unchanged. The segments are the same as those of
+ *  <tt>cub::DeviceSegmentedSort::SortPairs</tt>.
+ *
+ *  As with \p sort_by_key, the relative order of equivalent keys of a segment is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the keys the segments are in.
+ *  \param keys_last The end of the keys the segments are in.
+ *  \param values_first The beginning of the values.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator1 is mutable, and \c RandomAccessIterator1's \c value_type is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort the values of two segments by
+ *  their keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int  keys[]    = {3, 1, 2, 2, 0};
+ *  char values[]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  offsets[] = {0, 3, 5};
+ *
+ *  thrust::segmented_sort_by_key(thrust::host, keys, keys + 5, values, offsets, offsets + 2, offsets + 1);
+ *
+ *  // keys is now   {1, 2, 3, 0, 2}
+ *  // values is now {'b', 'c', 'a', 'e', 'd'}
+ *  \endcode
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ *  \see <tt>cub::DeviceSegmentedSort::SortPairs</tt>
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort_by_key sorts the keys of each segment of <tt>[keys_first, keys_last)</tt> into ascending order,
+ *  independently of the other segments, and permutes the values of the segment starting at \p values_first
+ *  alongside them. Segment \c i is <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>,
+ *  for every \c i in <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater
+ *  than its begin offset is empty. The segments must not overlap, but they need not be contiguous, and the keys and
+ *  values outside of every segment are left unchanged. The segments are the same as those of
+ *  <tt>cub::DeviceSegmentedSort::SortPairs</tt>.
+ *
+ *  As with \p sort_by_key, the relative order of equivalent keys of a segment is not guaranteed to be preserved.
+ *
+ *  \param keys_first The beginning of the keys the segments are in.
+ *  \param keys_last The end of the keys the segments are in.
+ *  \param values_first The beginning of the values.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator1 is mutable, and \c RandomAccessIterator1's \c value_type is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort the values of two segments by
+ *  their keys.
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  ...
+ *  int  keys[]    = {3, 1, 2, 2, 0};
+ *  char values[]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  offsets[] = {0, 3, 5};
+ *
+ *  thrust::segmented_sort_by_key(keys, keys + 5, values, offsets, offsets + 2, offsets + 1);
+ *
+ *  // keys is now   {1, 2, 3, 0, 2}
+ *  // values is now {'b', 'c', 'a', 'e', 'd'}
+ *  \endcode
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ *  \see <tt>cub::DeviceSegmentedSort::SortPairs</tt>
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+void segmented_sort_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+/*! \p segmented_sort_by_key sorts the keys of each segment of <tt>[keys_first, keys_last)</tt> into ascending order
+ *  according to the function object \p comp, independently of the other segments, and permutes the values of the
+ *  segment starting at \p values_first alongside them. Segment \c i is
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>, for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater than its begin
+ *  offset is empty. The segments must not overlap, but they need not be contiguous, and the keys and values outside
+ *  of every segment are left unchanged.
+ *
+ *  As with \p sort_by_key, the relative order of equivalent keys of a segment is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the keys the segments are in.
+ *  \param keys_last The end of the keys the segments are in.
+ *  \param values_first The beginning of the values.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator1 is mutable, and \c RandomAccessIterator1's \c value_type is convertible to
+ *          \p StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort the values of two segments by
+ *  their keys into descending order using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int  keys[]    = {3, 1, 2, 2, 0};
+ *  char values[]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  offsets[] = {0, 3, 5};
+ *
+ *  thrust::segmented_sort_by_key(
+ *    thrust::host, keys, keys + 5, values, offsets, offsets + 2, offsets + 1, thrust::greater<int>());
+ *
+ *  // keys is now   {3, 2, 1, 2, 0}
+ *  // values is now {'a', 'c', 'b', 'd', 'e'}
+ *  \endcode
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ *  \see <tt>cub::DeviceSegmentedSort::SortPairsDescending</tt>
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key sorts the keys of each segment of <tt>[keys_first, keys_last)</tt> into ascending order
+ *  according to the function object \p comp, independently of the other segments, and permutes the values of the
+ *  segment starting at \p values_first alongside them. Segment \c i is
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>, for every \c i in
+ *  <tt>[0, begin_offsets_last - begin_offsets_first)</tt>. A segment whose end offset is not greater than its begin
+ *  offset is empty. The segments must not overlap, but they need not be contiguous, and the keys and values outside
+ *  of every segment are left unchanged.
+ *
+ *  As with \p sort_by_key, the relative order of equivalent keys of a segment is not guaranteed to be preserved.
+ *
+ *  \param keys_first The beginning of the keys the segments are in.
+ *  \param keys_last The end of the keys the segments are in.
+ *  \param values_first The beginning of the values.
+ *  \param begin_offsets_first The beginning of the offsets of the first elements of the segments.
+ *  \param begin_offsets_last The end of the offsets of the first elements of the segments.
+ *  \param end_offsets_first The beginning of the offsets one past the last elements of the segments.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \c RandomAccessIterator1 is mutable, and \c RandomAccessIterator1's \c value_type is convertible to
+ *          \p StrictWeakOrdering's first argument type and second argument type.
+ *  \tparam RandomAccessIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam OffsetIterator1 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator1's \c value_type is an integral type.
+ *  \tparam OffsetIterator2 is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \c OffsetIterator2's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first +
+ *       (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to sort the values of two segments by
+ *  their keys into descending order.
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  int  keys[]    = {3, 1, 2, 2, 0};
+ *  char values[]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  offsets[] = {0, 3, 5};
+ *
+ *  thrust::segmented_sort_by_key(keys, keys + 5, values, offsets, offsets + 2, offsets + 1, thrust::greater<int>());
+ *
+ *  // keys is now   {3, 2, 1, 2, 0}
+ *  // values is now {'a', 'c', 'b', 'd', 'e'}
+ *  \endcode
+ *
+ *  \see \p sort_by_key
+ *  \see \p segmented_sort
+ *  \see <tt>cub::DeviceSegmentedSort::SortPairsDescending</tt>
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_sort.inl>
@@ -52,6 +52,7 @@
 #include <thrust/system/cpp/detail/gather.h>
 #include <thrust/system/cpp/detail/generate.h>
 #include <thrust/system/cpp/detail/get_value.h>
+#include <thrust/system/cpp/detail/histogram.h>
 #include <thrust/system/cpp/detail/inner_product.h>
 #include <thrust/system/cpp/detail/iter_swap.h>
 #include <thrust/system/cpp/detail/logical.h>
@@ -67,8 +68,10 @@
 #include <thrust/system/cpp/detail/scan.h>
 #include <thrust/system/cpp/detail/scan_by_key.h>
 #include <thrust/system/cpp/detail/scatter.h>
+#include <thrust/system/cpp/detail/segmented_sort.h>
 #include <thrust/system/cpp/detail/sequence.h>
 #include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/system/cpp/detail/shuffle.h>
 #include <thrust/system/cpp/detail/sort.h>
 #include <thrust/system/cpp/detail/swap_ranges.h>
 #include <thrust/system/cpp/detail/tabulate.h>
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// the purpose of this header is to #include the segmented_sort.h header
+// of the sequential, host, and device systems. It should be #included in any
+// code which uses adl to dispatch segmented_sort
+
+#include <thrust/system/detail/sequential/segmented_sort.h>
+
+// SCons can't see through the #defines below to figure out what this header
+// includes, so we fake it out by specifying all possible files we might end up
+// including inside an #if 0.
+#if 0
+#  include <thrust/system/cpp/detail/segmented_sort.h>
+#  include <thrust/system/cuda/detail/segmented_sort.h>
+#  include <thrust/system/omp/detail/segmented_sort.h>
+#  include <thrust/system/tbb/detail/segmented_sort.h>
+#endif
+
+#define __THRUST_HOST_SYSTEM_SEGMENTED_SORT_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/segmented_sort.h>
+#include __THRUST_HOST_SYSTEM_SEGMENTED_SORT_HEADER
+#undef __THRUST_HOST_SYSTEM_SEGMENTED_SORT_HEADER
+
+#define __THRUST_DEVICE_SYSTEM_SEGMENTED_SORT_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/segmented_sort.h>
+#include __THRUST_DEVICE_SYSTEM_SEGMENTED_SORT_HEADER
+#undef __THRUST_DEVICE_SYSTEM_SEGMENTED_SORT_HEADER
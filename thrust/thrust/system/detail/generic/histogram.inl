@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/generic/scalar/binary_search.h>
+#include <thrust/transform.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+// Maps a sample to its bin among num_bins bins of equal width which divide [lower, upper), or to -1 when it is
+// outside of them. Like CUB, integers are binned exactly and floating point samples by a precomputed scale.
+template <typename Sample, typename Level>
+struct histogram_even_binner
+{
+  using T = ::cuda::std::common_type_t<Sample, Level>;
+
+  T lower;
+  T upper;
+  T scale;
+  int num_bins;
+
+  _CCCL_HOST_DEVICE histogram_even_binner(int num_bins, Level lower, Level upper)
+      : lower(static_cast<T>(lower))
+      , upper(static_cast<T>(upper))
+      , scale(::cuda::std::is_integral_v<T> ? T(0) : static_cast<T>(static_cast<T>(num_bins) / (upper - lower)))
+      , num_bins(num_bins)
+  {}
+
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    const T x = static_cast<T>(sample);
+
+    // this also leaves out NaNs
+    if (!(lower <= x && x < upper))
+    {
+      return -1;
+    }
+
+    if constexpr (::cuda::std::is_integral_v<T>)
+    {
+      using Wide = unsigned long long;
+
+      const Wide offset = static_cast<Wide>(x) - static_cast<Wide>(lower);
+      const Wide width  = static_cast<Wide>(upper) - static_cast<Wide>(lower);
+      const Wide bins   = static_cast<Wide>(num_bins);
+
+      if (offset <= ~Wide(0) / bins)
+      {
+        return static_cast<int>(offset * bins / width);
+      }
+
+      // offset * bins does not fit, so the quotient and the remainder by width of offset times a growing prefix of
+      // the bits of bins are kept instead; as offset < width, each step adds at most one to the quotient
+      Wide quotient  = 0;
+      Wide remainder = 0;
+
+      for (int bit = 8 * static_cast<int>(sizeof(int)) - 1; bit >= 0; --bit)
+      {
+        quotient <<= 1;
+
+        if (remainder >= width - remainder)
+        {
+          ++quotient;
+          remainder -= width - remainder;
+        }
+        else
+        {
+          remainder += remainder;
+        }
+
+        if ((bins >> bit) & 1)
+        {
+          if (remainder >= width - offset)
+          {
+            ++quotient;
+            remainder -= width - offset;
+          }
+          else
+          {
+            remainder += offset;
+          }
+        }
+      }
+
+      return static_cast<int>(quotient);
+    }
+    else
+    {
+      const int bin = static_cast<int>((x - lower) * scale);
+
+      // rounding may take the samples just below upper past the last bin
+      return bin < num_bins ? bin : num_bins - 1;
+    }
+  }
+};
+
+// Maps a sample to the bin among those delimited by the ascending levels which holds it, or to -1 when it is
+// outside of them.
+template <typename RandomAccessIterator>
+struct histogram_range_binner
+{
+  RandomAccessIterator levels;
+  int num_levels;
+
+  _CCCL_HOST_DEVICE histogram_range_binner(RandomAccessIterator levels, int num_levels)
+      : levels(levels)
+      , num_levels(num_levels)
+  {}
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    // the first level above the sample is the upper boundary of its bin
+    const int pos = static_cast<int>(
+      thrust::system::detail::generic::scalar::upper_bound(levels, levels + num_levels, sample, thrust::less<>())
+      - levels);
+
+    return 0 < pos && pos < num_levels ? pos - 1 : -1;
+  }
+};
+
+namespace histogram_detail
+{
+
+// Sorts the bins of the samples, and finds the end of the run of every bin in them.
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OutputIterator, typename Binner>
+_CCCL_HOST_DEVICE OutputIterator count_bins(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  Binner binner)
+{
+  using Counter = thrust::detail::it_value_t<OutputIterator>;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  thrust::detail::temporary_array<int, ExecutionPolicy> bins(exec, thrust::distance(first, last));
+  thrust::transform(exec, first, last, bins.begin(), binner);
+
+  // samples outside of all bins are not counted
+  const auto bins_end = thrust::remove(exec, bins.begin(), bins.end(), -1);
+  thrust::sort(exec, bins.begin(), bins_end);
+
+  // the count of a bin is the distance between the end of its run and the end of the run of the bin before it
+  thrust::detail::temporary_array<Counter, ExecutionPolicy> ends(exec, num_bins);
+  thrust::upper_bound(
+    exec,
+    bins.begin(),
+    bins_end,
+    thrust::counting_iterator<int>(0),
+    thrust::counting_iterator<int>(num_bins),
+    ends.begin());
+
+  return thrust::adjacent_difference(exec, ends.begin(), ends.end(), histogram);
+}
+
+} // end namespace histogram_detail
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using Sample = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  return histogram_detail::count_bins(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    histogram_even_binner<Sample, Level>(num_levels - 1, lower_level, upper_level));
+}
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    histogram_range_binner<RandomAccessIterator2>(levels_first, num_levels));
+}
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file segmented_sort.h
+ *  \brief Generic implementations of segmented sort functions.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp);
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/segmented_sort.inl>
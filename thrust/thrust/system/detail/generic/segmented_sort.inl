@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace segmented_sort_detail
+{
+
+// XXX the largest segment sorted by insertion sort is a tuning opportunity; below it, the temporary storage and the
+//     passes of a sort over the whole segment cost more than the quadratic number of moves
+const static int insertion_sort_size = 64;
+
+// Sorts the segment [begin, end) of the keys, with insertion sort when it is small and with the sort of the
+// execution policy when it is not.
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct keys_sorter
+{
+  RandomAccessIterator keys;
+  StrictWeakOrdering comp;
+
+  _CCCL_HOST_DEVICE keys_sorter(RandomAccessIterator keys, StrictWeakOrdering comp)
+      : keys(keys)
+      , comp(comp)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename ExecutionPolicy, typename Size>
+  _CCCL_HOST_DEVICE void operator()(thrust::execution_policy<ExecutionPolicy>& exec, Size begin, Size end) const
+  {
+    if (end - begin <= insertion_sort_size)
+    {
+      thrust::system::detail::sequential::insertion_sort(keys + begin, keys + end, comp);
+    }
+    else
+    {
+      thrust::sort(exec, keys + begin, keys + end, comp);
+    }
+  }
+};
+
+// Sorts the segment [begin, end) of the keys and permutes the values alongside them.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+struct pairs_sorter
+{
+  RandomAccessIterator1 keys;
+  RandomAccessIterator2 values;
+  StrictWeakOrdering comp;
+
+  _CCCL_HOST_DEVICE pairs_sorter(RandomAccessIterator1 keys, RandomAccessIterator2 values, StrictWeakOrdering comp)
+      : keys(keys)
+      , values(values)
+      , comp(comp)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename ExecutionPolicy, typename Size>
+  _CCCL_HOST_DEVICE void operator()(thrust::execution_policy<ExecutionPolicy>& exec, Size begin, Size end) const
+  {
+    if (end - begin <= insertion_sort_size)
+    {
+      thrust::system::detail::sequential::insertion_sort_by_key(keys + begin, keys + end, values + begin, comp);
+    }
+    else
+    {
+      thrust::sort_by_key(exec, keys + begin, keys + end, values + begin, comp);
+    }
+  }
+};
+
+// The offsets of a segment, which is empty when its end is not past its begin.
+template <typename OffsetIterator1, typename OffsetIterator2>
+struct segment_offsets
+{
+  using Offset = ::cuda::std::common_type_t<thrust::detail::it_value_t<OffsetIterator1>,
+                                            thrust::detail::it_value_t<OffsetIterator2>>;
+
+  OffsetIterator1 begin_offsets;
+  OffsetIterator2 end_offsets;
+
+  _CCCL_HOST_DEVICE segment_offsets(OffsetIterator1 begin_offsets, OffsetIterator2 end_offsets)
+      : begin_offsets(begin_offsets)
+      , end_offsets(end_offsets)
+  {}
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE Offset begin(Size i) const
+  {
+    return static_cast<Offset>(begin_offsets[i]);
+  }
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE Offset end(Size i) const
+  {
+    return static_cast<Offset>(end_offsets[i]);
+  }
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE Offset size(Size i) const
+  {
+    const Offset b = begin(i);
+    const Offset e = end(i);
+
+    return b < e ? e - b : Offset(0);
+  }
+};
+
+// Sorts every segment sequentially by itself.
+template <typename OffsetIterator1, typename OffsetIterator2, typename Sorter>
+struct sort_each_segment
+{
+  segment_offsets<OffsetIterator1, OffsetIterator2> segments;
+  Sorter sorter;
+
+  _CCCL_HOST_DEVICE sort_each_segment(segment_offsets<OffsetIterator1, OffsetIterator2> segments, Sorter sorter)
+      : segments(segments)
+      , sorter(sorter)
+  {}
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE void operator()(Size i) const
+  {
+    const auto begin = segments.begin(i);
+    const auto end   = segments.end(i);
+
+    if (begin < end)
+    {
+      thrust::detail::seq_t seq;
+      sorter(seq, begin, end);
+    }
+  }
+};
+
+template <typename ExecutionPolicy, typename OffsetIterator1, typename OffsetIterator2, typename Sorter>
+_CCCL_HOST_DEVICE void sort_segments(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  Sorter sorter)
+{
+  using Size = thrust::detail::it_difference_t<OffsetIterator1>;
+
+  // XXX a thread per segment balances poorly when the segments differ widely in size
+  thrust::for_each(
+    exec,
+    thrust::counting_iterator<Size>(0),
+    thrust::counting_iterator<Size>(thrust::distance(begin_offsets_first, begin_offsets_last)),
+    sort_each_segment<OffsetIterator1, OffsetIterator2, Sorter>(
+      segment_offsets<OffsetIterator1, OffsetIterator2>(begin_offsets_first, end_offsets_first), sorter));
+}
+
+} // end namespace segmented_sort_detail
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OffsetIterator1, typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  thrust::segmented_sort(
+    exec, first, last, begin_offsets_first, begin_offsets_last, end_offsets_first, thrust::less<value_type>());
+} // end segmented_sort()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    segmented_sort_detail::keys_sorter<RandomAccessIterator, StrictWeakOrdering>(first, comp));
+} // end segmented_sort()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  thrust::segmented_sort_by_key(
+    exec,
+    keys_first,
+    keys_last,
+    values_first,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::less<value_type>());
+} // end segmented_sort_by_key()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    segmented_sort_detail::pairs_sorter<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>(
+      keys_first, values_first, comp));
+} // end segmented_sort_by_key()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
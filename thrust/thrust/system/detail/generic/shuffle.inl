@@ -83,6 +83,38 @@ public:
     return (static_cast<std::uint64_t>(state[0]) << right_side_bits) | static_cast<std::uint64_t>(state[1]);
   }
 
+  // The most values evaluated at once by the batched operator()
+  static constexpr std::uint32_t batch_size = 256;
+
+  // Evaluates the bijection at the count <= batch_size consecutive values starting at first. Each round is applied to
+  // all of the values before the next one, so that the rounds of consecutive values can run in SIMD lanes.
+  _CCCL_HOST_DEVICE void operator()(const std::uint64_t first, const std::uint32_t count, std::uint64_t* result) const
+  {
+    std::uint32_t left[batch_size];
+    std::uint32_t right[batch_size];
+    for (std::uint32_t j = 0; j < count; j++)
+    {
+      left[j]  = static_cast<std::uint32_t>((first + j) >> right_side_bits);
+      right[j] = static_cast<std::uint32_t>((first + j) & right_side_mask);
+    }
+    for (std::uint32_t i = 0; i < num_rounds; i++)
+    {
+      for (std::uint32_t j = 0; j < count; j++)
+      {
+        std::uint32_t hi, lo;
+        constexpr std::uint64_t M0 = UINT64_C(0xD2B74407B1CE6E93);
+        mulhilo(M0, left[j], hi, lo);
+        lo       = (lo << (right_side_bits - left_side_bits)) | right[j] >> left_side_bits;
+        left[j]  = ((hi ^ key[i]) ^ right[j]) & left_side_mask;
+        right[j] = lo & right_side_mask;
+      }
+    }
+    for (std::uint32_t j = 0; j < count; j++)
+    {
+      result[j] = (static_cast<std::uint64_t>(left[j]) << right_side_bits) | static_cast<std::uint64_t>(right[j]);
+    }
+  }
+
 private:
   // Perform 64 bit multiplication and save result in two 32 bit int
   static _CCCL_HOST_DEVICE void mulhilo(std::uint64_t a, std::uint64_t b, std::uint32_t& hi, std::uint32_t& lo)
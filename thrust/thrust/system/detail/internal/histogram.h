@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file histogram.h
+ *  \brief Privatized counters of the parallel histograms shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/type_traits>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// XXX the fewest samples per counter at which 16 bit samples are counted by value is a tuning opportunity;
+//     below it, zeroing and merging the counters of all values costs more than binning every sample
+const static std::size_t histogram_samples_per_value = 8;
+
+// Every thread counts its samples into counters of its own, which are then merged into those of another thread.
+//
+// Samples of at most 16 bits are counted by value, with a counter for each value of a sample instead of each
+// bin. Counting then takes no arithmetic per sample, and the counters of the values are folded into the bins once
+// at the end. Bytes are counted in four interleaved tables, so runs of equal samples do not serialize on the
+// increments of one counter.
+template <typename Sample, typename Binner>
+class histogram_counters
+{
+  static constexpr bool small_samples = ::cuda::std::is_integral_v<Sample> && !::cuda::std::is_same_v<Sample, bool>
+                                     && sizeof(Sample) <= 2;
+
+  using Key = typename ::cuda::std::
+    conditional_t<small_samples, ::cuda::std::make_unsigned<Sample>, ::cuda::std::type_identity<unsigned char>>::type;
+
+  static constexpr std::size_t num_values = std::size_t(1) << (8 * sizeof(Key));
+
+public:
+  histogram_counters(Binner binner, int num_bins, std::size_t num_samples)
+      : m_binner(binner)
+      , m_num_bins(num_bins)
+      , m_by_value(small_samples
+                   && (num_values <= static_cast<std::size_t>(num_bins)
+                       || num_values <= num_samples / histogram_samples_per_value))
+  {}
+
+  // the number of counters of a thread
+  std::size_t size() const
+  {
+    return m_by_value ? num_values : static_cast<std::size_t>(m_num_bins);
+  }
+
+  template <typename RandomAccessIterator, typename Size>
+  void count(RandomAccessIterator first, Size n, std::size_t* counters) const
+  {
+    if constexpr (small_samples)
+    {
+      if (m_by_value)
+      {
+        count_values(first, n, counters);
+        return;
+      }
+    }
+
+    for (Size i = 0; i < n; i++)
+    {
+      const int bin = m_binner(first[i]);
+
+      if (bin >= 0)
+      {
+        ++counters[bin];
+      }
+    }
+  }
+
+  // adds the counters of another thread to these
+  void merge(std::size_t* counters, const std::size_t* other) const
+  {
+    const std::size_t m = size();
+
+    for (std::size_t i = 0; i < m; i++)
+    {
+      counters[i] += other[i];
+    }
+  }
+
+  template <typename OutputIterator>
+  OutputIterator write(const std::size_t* counters, OutputIterator histogram) const
+  {
+    using Counter = thrust::detail::it_value_t<OutputIterator>;
+
+    if (!m_by_value)
+    {
+      for (int i = 0; i < m_num_bins; i++)
+      {
+        histogram[i] = static_cast<Counter>(counters[i]);
+      }
+
+      return histogram + m_num_bins;
+    }
+
+    for (int i = 0; i < m_num_bins; i++)
+    {
+      histogram[i] = Counter(0);
+    }
+
+    for (std::size_t v = 0; v < num_values; v++)
+    {
+      if (counters[v] != 0)
+      {
+        const int bin = m_binner(static_cast<Sample>(static_cast<Key>(v)));
+
+        if (bin >= 0)
+        {
+          histogram[bin] += static_cast<Counter>(counters[v]);
+        }
+      }
+    }
+
+    return histogram + m_num_bins;
+  }
+
+private:
+  template <typename RandomAccessIterator, typename Size>
+  void count_values(RandomAccessIterator first, Size n, std::size_t* counters) const
+  {
+    if constexpr (sizeof(Key) == 1)
+    {
+      std::size_t tables[4][num_values] = {};
+
+      Size i = 0;
+
+      for (; i + 4 <= n; i += 4)
+      {
+        ++tables[0][static_cast<Key>(static_cast<Sample>(first[i]))];
+        ++tables[1][static_cast<Key>(static_cast<Sample>(first[i + 1]))];
+        ++tables[2][static_cast<Key>(static_cast<Sample>(first[i + 2]))];
+        ++tables[3][static_cast<Key>(static_cast<Sample>(first[i + 3]))];
+      }
+
+      for (; i < n; i++)
+      {
+        ++tables[0][static_cast<Key>(static_cast<Sample>(first[i]))];
+      }
+
+      for (std::size_t v = 0; v < num_values; v++)
+      {
+        counters[v] += tables[0][v] + tables[1][v] + tables[2][v] + tables[3][v];
+      }
+    }
+    else
+    {
+      // the values of wider samples rarely repeat back to back
+      for (Size i = 0; i < n; i++)
+      {
+        ++counters[static_cast<Key>(static_cast<Sample>(first[i]))];
+      }
+    }
+  }
+
+  Binner m_binner;
+  int m_num_bins;
+  bool m_by_value;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file merge_path.h
+ *  \brief Merge path (co-rank) and balanced path partitioning shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/binary_search.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Returns the number of elements taken from [first1, first1 + n1) among the
+// first `diag` elements of the stable merge of the two sorted ranges. Ties are
+// resolved in favor of the first range, so splitting a merge at any set of
+// diagonals and merging each piece independently with thrust::merge produces
+// exactly the same output as one sequential merge.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path(RandomAccessIterator1 first1,
+                Size n1,
+                RandomAccessIterator2 first2,
+                Size n2,
+                Size diag,
+                StrictWeakOrdering comp)
+{
+  Size begin = diag > n2 ? diag - n2 : Size(0);
+  Size end   = diag < n1 ? diag : n1;
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    if (comp(thrust::raw_reference_cast(first2[diag - 1 - mid]), thrust::raw_reference_cast(first1[mid])))
+    {
+      end = mid;
+    }
+    else
+    {
+      begin = mid + 1;
+    }
+  }
+
+  return begin;
+}
+
+namespace merge_path_detail
+{
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename T,
+          typename StrictWeakOrdering>
+thrust::pair<Size, Size> balance_run(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size i,
+  Size j,
+  const T& key,
+  StrictWeakOrdering comp)
+{
+  // locate the runs of keys equivalent to key in both ranges
+  Size begin1 = thrust::lower_bound(thrust::seq, first1, first1 + i, key, comp) - first1;
+  Size begin2 = thrust::lower_bound(thrust::seq, first2, first2 + j, key, comp) - first2;
+  Size end1   = thrust::upper_bound(thrust::seq, first1 + i, first1 + n1, key, comp) - first1;
+  Size end2   = thrust::upper_bound(thrust::seq, first2 + j, first2 + n2, key, comp) - first2;
+
+  // the set algorithms pair up equivalent keys of both ranges one by one and
+  // then consume whatever is left of the longer run
+  Size pairs    = (end1 - begin1) < (end2 - begin2) ? (end1 - begin1) : (end2 - begin2);
+  Size consumed = (i + j) - (begin1 + begin2);
+
+  if (consumed <= 2 * pairs)
+  {
+    return thrust::make_pair(begin1 + consumed / 2, begin2 + consumed / 2);
+  }
+
+  Size excess = consumed - 2 * pairs;
+
+  if ((end1 - begin1) > (end2 - begin2))
+  {
+    return thrust::make_pair(begin1 + pairs + excess, begin2 + pairs);
+  }
+
+  return thrust::make_pair(begin1 + pairs, begin2 + pairs + excess);
+}
+
+} // namespace merge_path_detail
+
+// Returns a split (i, j) of the two sorted ranges with i + j equal to `diag`
+// or `diag - 1`, such that runs of equivalent keys are divided between the
+// two ranges the same way set_union, set_intersection, set_difference and
+// set_symmetric_difference pair them up. Applying a sequential set operation
+// independently to the pieces between consecutive splits therefore produces
+// exactly the output of one sequential set operation.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+thrust::pair<Size, Size> balanced_path(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diag,
+  StrictWeakOrdering comp)
+{
+  Size i = merge_path(first1, n1, first2, n2, diag, comp);
+  Size j = diag - i;
+
+  if (i == n1 && j == n2)
+  {
+    return thrust::make_pair(i, j);
+  }
+
+  // the next element of the merge may belong to a run which straddles the diagonal
+  if (j == n2 || (i < n1 && !comp(thrust::raw_reference_cast(first2[j]), thrust::raw_reference_cast(first1[i]))))
+  {
+    return merge_path_detail::balance_run(first1, n1, first2, n2, i, j, thrust::raw_reference_cast(first1[i]), comp);
+  }
+
+  return merge_path_detail::balance_run(first1, n1, first2, n2, i, j, thrust::raw_reference_cast(first2[j]), comp);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file radix_sort.h
+ *  \brief Per-tile building blocks of the parallel LSD radix sort shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// XXX the minimum number of keys per tile is a tuning opportunity; smaller
+//     tiles leave too few keys per bucket to amortize the offset bookkeeping
+const static int radix_sort_tile_granularity = 1 << 14;
+
+template <typename KeyType>
+struct radix_sort_traits
+{
+  using Encoder     = thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+
+  static const unsigned int radix_bits  = 8;
+  static const unsigned int num_buckets = 1u << radix_bits;
+  static const unsigned int num_passes  = (8 * sizeof(EncodedType) + radix_bits - 1) / radix_bits;
+};
+
+// The parallel radix sort is used for the same keys and comparators as the
+// sequential primitive sort, as long as the keys encode to unsigned integers.
+template <typename KeyType, typename Compare>
+struct use_radix_sort
+    : ::cuda::std::_And<thrust::system::detail::sequential::sort_detail::use_primitive_sort<KeyType, Compare>,
+                        ::cuda::std::is_unsigned<typename radix_sort_traits<KeyType>::EncodedType>>
+{};
+
+// Returns the bucket of a key in one LSD pass. A descending sort complements
+// the digit instead of reversing the result, which keeps the sort stable.
+template <typename KeyType, bool Descending>
+struct radix_sort_digit
+{
+  using traits = radix_sort_traits<KeyType>;
+
+  static const unsigned int num_buckets = traits::num_buckets;
+
+  typename traits::Encoder encode;
+  unsigned int shift;
+
+  explicit radix_sort_digit(unsigned int pass)
+      : encode()
+      , shift(pass * traits::radix_bits)
+  {}
+
+  unsigned int operator()(const KeyType& key) const
+  {
+    const unsigned int digit = static_cast<unsigned int>((encode(key) >> shift) & (num_buckets - 1));
+
+    return Descending ? (num_buckets - 1) - digit : digit;
+  }
+};
+
+// Counts the keys of [begin, end) in every bucket.
+template <typename RandomAccessIterator, typename Size, typename Digit>
+void radix_sort_histogram(RandomAccessIterator keys, Size begin, Size end, Digit digit, std::size_t* histogram)
+{
+  for (unsigned int b = 0; b < Digit::num_buckets; b++)
+  {
+    histogram[b] = 0;
+  }
+
+  for (Size i = begin; i < end; i++)
+  {
+    ++histogram[digit(thrust::raw_reference_cast(keys[i]))];
+  }
+}
+
+// Replaces the count of `bucket` in each of the tile histograms by the number
+// of keys of that bucket in all preceding tiles, and returns the bucket total.
+template <typename Size>
+std::size_t
+radix_sort_bucket_scan(std::size_t* histograms, Size num_tiles, unsigned int num_buckets, unsigned int bucket)
+{
+  std::size_t sum = 0;
+
+  for (Size t = 0; t < num_tiles; t++)
+  {
+    std::size_t count                    = histograms[t * num_buckets + bucket];
+    histograms[t * num_buckets + bucket] = sum;
+    sum += count;
+  }
+
+  return sum;
+}
+
+// Replaces the bucket totals by the offsets of the buckets in the output.
+// Returns false if a single bucket holds all n keys, in which case the pass
+// would not move anything and can be skipped.
+template <typename Size>
+bool radix_sort_bucket_offsets(std::size_t* totals, unsigned int num_buckets, Size n)
+{
+  bool moves = true;
+
+  std::size_t sum = 0;
+
+  for (unsigned int b = 0; b < num_buckets; b++)
+  {
+    std::size_t count = totals[b];
+
+    if (count == static_cast<std::size_t>(n))
+    {
+      moves = false;
+    }
+
+    totals[b] = sum;
+    sum += count;
+  }
+
+  return moves;
+}
+
+// Scatters the keys of [begin, end) to their positions in the output of one
+// pass. Keys are visited in order, so the pass is stable.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename Digit>
+void radix_sort_scatter(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 keys_dst,
+  Size begin,
+  Size end,
+  Digit digit,
+  const std::size_t* bucket_offsets,
+  const std::size_t* tile_offsets)
+{
+  std::size_t offsets[Digit::num_buckets];
+
+  for (unsigned int b = 0; b < Digit::num_buckets; b++)
+  {
+    offsets[b] = bucket_offsets[b] + tile_offsets[b];
+  }
+
+  for (Size i = begin; i < end; i++)
+  {
+    keys_dst[offsets[digit(thrust::raw_reference_cast(keys_src[i]))]++] = keys_src[i];
+  }
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+void radix_sort_scatter_by_key(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  Size begin,
+  Size end,
+  Digit digit,
+  const std::size_t* bucket_offsets,
+  const std::size_t* tile_offsets)
+{
+  std::size_t offsets[Digit::num_buckets];
+
+  for (unsigned int b = 0; b < Digit::num_buckets; b++)
+  {
+    offsets[b] = bucket_offsets[b] + tile_offsets[b];
+  }
+
+  for (Size i = begin; i < end; i++)
+  {
+    const std::size_t j = offsets[digit(thrust::raw_reference_cast(keys_src[i]))]++;
+
+    keys_dst[j]   = keys_src[i];
+    values_dst[j] = values_src[i];
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file segmented_sort.h
+ *  \brief The packing of the segments of the parallel segmented sorts shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// XXX the smallest segment sorted by all of the threads together is a tuning opportunity; below it, forking the
+//     threads of a parallel sort costs more than sorting the segment on one thread alongside other segments
+const static std::int64_t segmented_sort_large_segment_size = 1 << 15;
+
+// The segments of a segmented sort on the CPU.
+//
+// Small segments are packed into parts of about the same number of elements, in the order of the segments, and
+// each part is sorted by a single thread one segment after the other. A part ends where the inclusive scan of the
+// packed sizes of the segments passes its share of their sum. Large segments are left out of the parts, and each
+// of them is sorted in turn by all of the threads.
+template <typename OffsetIterator1, typename OffsetIterator2>
+class segmented_sort_segments
+{
+public:
+  using Size = std::int64_t;
+
+  segmented_sort_segments(OffsetIterator1 begin_offsets, OffsetIterator2 end_offsets)
+      : m_offsets(begin_offsets, end_offsets)
+  {}
+
+  bool is_large(Size i) const
+  {
+    return static_cast<Size>(m_offsets.size(i)) >= segmented_sort_large_segment_size;
+  }
+
+  // the number of elements of a segment packed into the parts, which is zero for a large segment
+  Size operator()(Size i) const
+  {
+    return is_large(i) ? Size(0) : static_cast<Size>(m_offsets.size(i));
+  }
+
+  // the first segment of a part, given the inclusive scan of the packed sizes of the segments
+  static Size part_begin(const Size* packed_ends, Size num_segments, Size part, Size num_parts)
+  {
+    const Size num_packed = packed_ends[num_segments - 1];
+
+    // the part begins with the first segment which ends past the share of the parts before it
+    const Size bound = num_packed / num_parts * part + num_packed % num_parts * part / num_parts;
+
+    return static_cast<Size>(std::upper_bound(packed_ends, packed_ends + num_segments, bound) - packed_ends);
+  }
+
+  // sorts the small segments of [first_segment, last_segment) one after the other
+  template <typename Sorter>
+  void sort_small(Sorter sorter, Size first_segment, Size last_segment) const
+  {
+    thrust::detail::seq_t seq;
+
+    for (Size i = first_segment; i < last_segment; i++)
+    {
+      const auto begin = m_offsets.begin(i);
+      const auto end   = m_offsets.end(i);
+
+      if (begin < end && !is_large(i))
+      {
+        sorter(seq, begin, end);
+      }
+    }
+  }
+
+  // sorts the large segments of [0, num_segments) one after the other with the sort of the execution policy
+  template <typename ExecutionPolicy, typename Sorter>
+  void sort_large(ExecutionPolicy& exec, Sorter sorter, Size num_segments) const
+  {
+    // XXX finding the large segments in parallel is a tuning opportunity
+    for (Size i = 0; i < num_segments; i++)
+    {
+      if (is_large(i))
+      {
+        sorter(exec, m_offsets.begin(i), m_offsets.end(i));
+      }
+    }
+  }
+
+private:
+  thrust::system::detail::generic::segmented_sort_detail::segment_offsets<OffsetIterator1, OffsetIterator2> m_offsets;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file set_operations.h
+ *  \brief The partitioned set operations shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+struct serial_set_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+// XXX the fewest elements of a partition is a tuning opportunity; below it, finding the partition on the balanced
+//     path and running the set operation over it twice costs more than running it on another thread saves
+const static std::int64_t set_operation_partition_size = 10000;
+
+// The partitions of a set operation on the CPU.
+//
+// Both inputs are split along the balanced path at the begin of every interval of a decomposition of their combined
+// size, which keeps a run of equivalent elements in the same partition as its matches in the other input. The output
+// of every partition is counted first, the counts are scanned into offsets and finally every partition writes its
+// output at its own offset, which is where a single sequential set operation would have written it. Every step needs
+// the previous one to have finished for all of the partitions: a partition ends where the next one is split.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename Size,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+class set_operation_partitions
+{
+public:
+  set_operation_partitions(
+    thrust::execution_policy<DerivedPolicy>& exec,
+    InputIterator1 first1,
+    Size n1,
+    InputIterator2 first2,
+    Size n2,
+    const uniform_decomposition<Size>& decomp,
+    StrictWeakOrdering comp,
+    SetOperation set_op)
+      : m_first1(first1)
+      , m_first2(first2)
+      , m_n1(n1)
+      , m_n2(n2)
+      , m_decomp(decomp)
+      , m_comp(comp)
+      , m_set_op(set_op)
+      , m_splits1(exec, decomp.size() + 1)
+      , m_splits2(exec, decomp.size() + 1)
+      , m_offsets(exec, decomp.size() + 1)
+      , m_s1(thrust::raw_pointer_cast(m_splits1.data()))
+      , m_s2(thrust::raw_pointer_cast(m_splits2.data()))
+      , m_off(thrust::raw_pointer_cast(m_offsets.data()))
+  {
+    m_s1[size()] = n1;
+    m_s2[size()] = n2;
+    m_off[0]     = 0;
+  }
+
+  Size size() const
+  {
+    return m_decomp.size();
+  }
+
+  // finds where partition p begins in both inputs
+  void split(Size p) const
+  {
+    thrust::pair<Size, Size> s = balanced_path(m_first1, m_n1, m_first2, m_n2, m_decomp[p].begin(), m_comp);
+
+    m_s1[p] = s.first;
+    m_s2[p] = s.second;
+  }
+
+  // counts the output of partition p
+  void count(Size p) const
+  {
+    thrust::discard_iterator<> counter;
+
+    m_off[p + 1] = m_set_op(m_first1 + m_s1[p],
+                            m_first1 + m_s1[p + 1],
+                            m_first2 + m_s2[p],
+                            m_first2 + m_s2[p + 1],
+                            counter,
+                            m_comp)
+                 - counter;
+  }
+
+  // turns the counts into the offset of every partition
+  void scan() const
+  {
+    for (Size p = 0; p < size(); p++)
+    {
+      m_off[p + 1] += m_off[p];
+    }
+  }
+
+  // writes the output of partition p at its offset
+  template <typename OutputIterator>
+  void write(Size p, OutputIterator result) const
+  {
+    m_set_op(
+      m_first1 + m_s1[p], m_first1 + m_s1[p + 1], m_first2 + m_s2[p], m_first2 + m_s2[p + 1], result + m_off[p], m_comp);
+  }
+
+  Size output_size() const
+  {
+    return m_off[size()];
+  }
+
+private:
+  InputIterator1 m_first1;
+  InputIterator2 m_first2;
+  Size m_n1;
+  Size m_n2;
+  uniform_decomposition<Size> m_decomp;
+  StrictWeakOrdering m_comp;
+  SetOperation m_set_op;
+  thrust::detail::temporary_array<Size, DerivedPolicy> m_splits1;
+  thrust::detail::temporary_array<Size, DerivedPolicy> m_splits2;
+  thrust::detail::temporary_array<Size, DerivedPolicy> m_offsets;
+  Size* m_s1;
+  Size* m_s2;
+  Size* m_off;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file shuffle.h
+ *  \brief The per-interval work of the parallel shuffle_copy shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// shuffle_copy gathers the input at the values of the bijection over [0, n) that fall into [0, m), in the order of
+// their indices. This produces the same permutation as the generic implementation. An interval of indices first
+// counts its values in [0, m), and once it knows how many values the intervals before it have, it evaluates the
+// bijection again to write its part of the output. Both passes evaluate the bijection a batch at a time.
+template <typename RandomIterator, typename OutputIterator>
+struct shuffle_body
+{
+  using feistel_bijection = thrust::system::detail::generic::feistel_bijection;
+
+  std::uint64_t m;
+  feistel_bijection bijection;
+  RandomIterator first;
+  OutputIterator result;
+
+  shuffle_body(std::uint64_t m, const feistel_bijection& bijection, RandomIterator first, OutputIterator result)
+      : m(m)
+      , bijection(bijection)
+      , first(first)
+      , result(result)
+  {}
+
+  template <typename Size>
+  Size count(Size begin, Size end) const
+  {
+    std::uint64_t keys[feistel_bijection::batch_size];
+
+    Size n = 0;
+
+    for (Size i = begin; i < end; i += feistel_bijection::batch_size)
+    {
+      const std::uint32_t batch = static_cast<std::uint32_t>(
+        (end - i) < Size(feistel_bijection::batch_size) ? (end - i) : Size(feistel_bijection::batch_size));
+
+      bijection(static_cast<std::uint64_t>(i), batch, keys);
+
+      for (std::uint32_t j = 0; j < batch; j++)
+      {
+        n += keys[j] < m;
+      }
+    }
+
+    return n;
+  }
+
+  // returns the number of values written
+  template <typename Size>
+  Size write(Size begin, Size end, Size offset, Size = Size()) const
+  {
+    std::uint64_t keys[feistel_bijection::batch_size];
+
+    Size n = 0;
+
+    for (Size i = begin; i < end; i += feistel_bijection::batch_size)
+    {
+      const std::uint32_t batch = static_cast<std::uint32_t>(
+        (end - i) < Size(feistel_bijection::batch_size) ? (end - i) : Size(feistel_bijection::batch_size));
+
+      bijection(static_cast<std::uint64_t>(i), batch, keys);
+
+      for (std::uint32_t j = 0; j < batch; j++)
+      {
+        if (keys[j] < m)
+        {
+          result[offset + n] = first[keys[j]];
+          ++n;
+        }
+      }
+    }
+
+    return n;
+  }
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,289 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file vectorized_search.h
+ *  \brief Serial building blocks of the vectorized binary searches shared by the CPU backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// XXX the table size in bytes from which random probes are searched in an
+//     Eytzinger layout is a tuning opportunity; the branchless search is faster
+//     as long as the table stays in cache
+const static std::size_t eytzinger_search_threshold = std::size_t(1) << 23;
+
+// Every search looks for the first table element which does not precede the
+// value. lower_bound and binary_search consider an element to precede the value
+// if it compares less, upper_bound if the value does not compare less than it.
+template <typename StrictWeakOrdering>
+struct lower_bound_search
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename T1, typename T2>
+  bool before(const T1& element, const T2& value) const
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T>
+  Size result(RandomAccessIterator, Size, Size i, const T&) const
+  {
+    return i;
+  }
+};
+
+template <typename StrictWeakOrdering>
+struct upper_bound_search
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename T1, typename T2>
+  bool before(const T1& element, const T2& value) const
+  {
+    return !comp(value, element);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T>
+  Size result(RandomAccessIterator, Size, Size i, const T&) const
+  {
+    return i;
+  }
+};
+
+template <typename StrictWeakOrdering>
+struct binary_search_search
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename T1, typename T2>
+  bool before(const T1& element, const T2& value) const
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T>
+  bool result(RandomAccessIterator table, Size n, Size i, const T& value) const
+  {
+    return i != n && !comp(value, table[i]);
+  }
+};
+
+// Binary search of [table, table + n) without data dependent branches, which
+// lets the processor overlap the loads of consecutive searches.
+template <typename RandomAccessIterator, typename Size, typename T, typename Search>
+Size branchless_search(RandomAccessIterator table, Size n, const T& value, const Search& search)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  Size base = 0;
+
+  while (n > 1)
+  {
+    const Size half = n / 2;
+
+    base = search.before(table[base + half], value) ? base + half : base;
+    n -= half;
+  }
+
+  return base + (search.before(table[base], value) ? 1 : 0);
+}
+
+// Searches [table + hint, table + n) with steps of doubling size, followed by a
+// binary search of the last step. All elements before `hint` must precede the
+// value, and the cost is logarithmic in the distance of the result from `hint`.
+template <typename RandomAccessIterator, typename Size, typename T, typename Search>
+Size galloping_search(RandomAccessIterator table, Size n, Size hint, const T& value, const Search& search)
+{
+  Size lo   = hint;
+  Size hi   = hint;
+  Size step = 1;
+
+  while (hi < n && search.before(table[hi], value))
+  {
+    lo   = hi + 1;
+    hi   = (n - lo > step) ? lo + step : n;
+    step = 2 * step;
+  }
+
+  return lo + branchless_search(table + lo, hi - lo, value, search);
+}
+
+// Searches the values [begin, end) in order, starting every search from the
+// result of the previous one. While the values ascend, this merges them with
+// the table instead of searching it from scratch. Returns the position of the
+// first value which is ordered before its predecessor's result, or `end` if
+// all values have been searched.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename Index,
+          typename Search>
+Index merge_search(
+  RandomAccessIterator1 table,
+  Size n,
+  RandomAccessIterator2 values,
+  RandomAccessIterator3 output,
+  Index begin,
+  Index end,
+  const Search& search)
+{
+  Size finger = 0;
+
+  for (Index i = begin; i < end; i++)
+  {
+    if (finger > 0 && !search.before(table[finger - 1], values[i]))
+    {
+      return i;
+    }
+
+    finger    = galloping_search(table, n, finger, values[i], search);
+    output[i] = search.result(table, n, finger, values[i]);
+  }
+
+  return end;
+}
+
+// Searches each of the values [begin, end) independently.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename Index,
+          typename Search>
+void independent_search(
+  RandomAccessIterator1 table,
+  Size n,
+  RandomAccessIterator2 values,
+  RandomAccessIterator3 output,
+  Index begin,
+  Index end,
+  const Search& search)
+{
+  for (Index i = begin; i < end; i++)
+  {
+    output[i] = search.result(table, n, branchless_search(table, n, values[i], search), values[i]);
+  }
+}
+
+// Stores [table, table + n) in breadth-first order of the implicit binary
+// search tree, so that the first levels of all searches share a few cache
+// lines. layout[k] for k in [1, n] is the node whose children are 2k and 2k + 1,
+// and ranks[k] is its position in the table.
+template <typename RandomAccessIterator, typename T, typename Size>
+void eytzinger_layout(RandomAccessIterator table, Size n, T* layout, Size* ranks)
+{
+  // start at the leftmost node and visit the tree in order
+  Size k = 1;
+
+  while (2 * k <= n)
+  {
+    k = 2 * k;
+  }
+
+  for (Size i = 0; i < n; i++)
+  {
+    layout[k] = table[i];
+    ranks[k]  = i;
+
+    if (2 * k + 1 <= n)
+    {
+      k = 2 * k + 1;
+
+      while (2 * k <= n)
+      {
+        k = 2 * k;
+      }
+    }
+    else
+    {
+      while (k % 2 == 1)
+      {
+        k = k / 2;
+      }
+
+      k = k / 2;
+    }
+  }
+}
+
+// Searches each of the values [begin, end) in the Eytzinger layout of the
+// table. The descendants of a node a few levels down are adjacent in memory,
+// so each step prefetches the cache line the search will reach next.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename T,
+          typename Size,
+          typename Index,
+          typename Search>
+void eytzinger_search(
+  const T* layout,
+  const Size* ranks,
+  RandomAccessIterator1 table,
+  Size n,
+  RandomAccessIterator2 values,
+  RandomAccessIterator3 output,
+  Index begin,
+  Index end,
+  const Search& search)
+{
+  const Size lookahead = sizeof(T) < 32 ? Size(64 / sizeof(T)) : Size(2);
+
+  for (Index i = begin; i < end; i++)
+  {
+    Size k = 1;
+
+    while (k <= n)
+    {
+      if (lookahead * k <= n)
+      {
+        _CCCL_BUILTIN_PREFETCH(layout + lookahead * k)
+      }
+
+      k = 2 * k + (search.before(layout[k], values[i]) ? 1 : 0);
+    }
+
+    // the result is the last node where the search went left, or the end of
+    // the table if it never did
+    while (k % 2 == 1)
+    {
+      k = k / 2;
+    }
+
+    k = k / 2;
+
+    output[i] = search.result(table, n, k == 0 ? n : ranks[k], values[i]);
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
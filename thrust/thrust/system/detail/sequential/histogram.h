@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file histogram.h
+ *  \brief Sequential implementations of histogram algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace histogram_detail
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename OutputIterator, typename Binner>
+_CCCL_HOST_DEVICE OutputIterator
+count_bins(RandomAccessIterator first, RandomAccessIterator last, OutputIterator histogram, int num_bins, Binner binner)
+{
+  using Counter = thrust::detail::it_value_t<OutputIterator>;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  for (int i = 0; i < num_bins; i++)
+  {
+    histogram[i] = Counter(0);
+  }
+
+  for (; first != last; ++first)
+  {
+    const int bin = binner(*first);
+
+    if (bin >= 0)
+    {
+      histogram[bin] += Counter(1);
+    }
+  }
+
+  return histogram + num_bins;
+}
+
+} // end namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using Sample = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  return histogram_detail::count_bins(
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_even_binner<Sample, Level>(num_levels - 1, lower_level, upper_level));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_range_binner<RandomAccessIterator2>(levels_first, num_levels));
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file segmented_sort.h
+ *  \brief Sequential implementations of segmented sort algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace segmented_sort_detail
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator1, typename OffsetIterator2, typename Sorter>
+_CCCL_HOST_DEVICE void sort_segments(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  Sorter sorter)
+{
+  using Size = thrust::detail::it_difference_t<OffsetIterator1>;
+
+  const thrust::system::detail::generic::segmented_sort_detail::segment_offsets<OffsetIterator1, OffsetIterator2>
+    segments(begin_offsets_first, end_offsets_first);
+
+  const Size num_segments = thrust::distance(begin_offsets_first, begin_offsets_last);
+
+  for (Size i = 0; i < num_segments; i++)
+  {
+    const auto begin = segments.begin(i);
+    const auto end   = segments.end(i);
+
+    if (begin < end)
+    {
+      sorter(exec, begin, end);
+    }
+  }
+}
+
+} // end namespace segmented_sort_detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::keys_sorter<RandomAccessIterator, StrictWeakOrdering>(
+      first, comp));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::
+      pairs_sorter<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>(keys_first, values_first, comp));
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -27,12 +27,10 @@
 #endif // no system header
 
 #include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/iterator/transform_iterator.h>
-#include <thrust/iterator/zip_iterator.h>
-#include <thrust/scatter.h>
 
 #include <cuda/std/utility>
 
@@ -95,9 +93,9 @@ struct RadixEncoder<short>
 template <>
 struct RadixEncoder<int>
 {
-  _CCCL_HOST_DEVICE unsigned long operator()(long x) const
+  _CCCL_HOST_DEVICE unsigned int operator()(int x) const
   {
-    return x ^ static_cast<unsigned int>(1) << (8 * sizeof(unsigned int) - 1);
+    return static_cast<unsigned int>(x) ^ static_cast<unsigned int>(1) << (8 * sizeof(unsigned int) - 1);
   }
 };
 
@@ -152,84 +150,144 @@ struct RadixEncoder<double>
   }
 };
 
-// this functor returns a key's to its histogram bucket count and post-increments the bucket
-template <unsigned int RadixBits, typename KeyType>
-struct bucket_functor
-{
-  using Encoder                    = RadixEncoder<KeyType>;
-  using EncodedType                = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
-  using result_type                = size_t;
-  static const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
-
-  Encoder encode;
-  EncodedType bit_shift;
-  size_t* histogram;
-
-  _CCCL_HOST_DEVICE bucket_functor(EncodedType bit_shift, size_t* histogram)
-      : encode()
-      , bit_shift(bit_shift)
-      , histogram(histogram)
-  {}
+// XXX the size of the write-combining buffers is a tuning opportunity; a few cache lines per bucket amortize
+//     writing a buffer out, while the buffers of all buckets still fit in the L2 cache
+const static size_t radix_sort_write_combining_bytes = 256;
 
-  inline _CCCL_HOST_DEVICE size_t operator()(KeyType key)
-  {
-    const EncodedType x = encode(key);
+// XXX the fewest digit bits and keys that are scattered through write-combining buffers are a tuning opportunity;
+//     the output of up to 256 buckets, or of an input that fits in the cache, is combined by the cache anyway
+const static unsigned int radix_sort_write_combining_bits = 9;
+const static size_t radix_sort_write_combining_threshold  = 1 << 21;
 
-    // note that we mutate the histogram here
-    return histogram[(x >> bit_shift) & BitMask]++;
-  }
+// The number of keys of the write-combining buffer of a bucket.
+template <typename KeyType>
+struct radix_sort_buffer_size
+{
+  static const unsigned int value =
+    sizeof(KeyType) < radix_sort_write_combining_bytes
+      ? static_cast<unsigned int>(radix_sort_write_combining_bytes / sizeof(KeyType))
+      : 1u;
 };
 
+// Scatters [keys_first, keys_first + n) to the positions that histogram holds for the buckets of the keys, and advances
+// them. Keys are visited in order, so the scatter is stable.
 template <unsigned int RadixBits,
-          typename DerivedPolicy,
+          bool HasValues,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
-          typename Integer>
-inline _CCCL_HOST_DEVICE void radix_shuffle_n(
-  sequential::execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename EncodedType>
+_CCCL_HOST_DEVICE void radix_shuffle_n(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
   const size_t n,
-  RandomAccessIterator2 result,
-  Integer bit_shift,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  EncodedType bit_shift,
   size_t* histogram)
 {
   using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(
-    exec,
-    first,
-    first + n,
-    thrust::make_transform_iterator(first, bucket_functor<RadixBits, KeyType>(bit_shift, histogram)),
-    result);
+  const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
+
+  RadixEncoder<KeyType> encode;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    const KeyType key = keys_first[i];
+    const size_t j    = histogram[(encode(key) >> bit_shift) & BitMask]++;
+
+    keys_result[j] = key;
+
+    if (HasValues)
+    {
+      values_result[j] = values_first[i];
+    }
+  }
 }
 
+// Like radix_shuffle_n, but gathers the keys of every bucket in a buffer of a few cache lines, and writes the
+// buffer out once it is full. Every write to the output then fills whole lines, instead of one key of as many
+// lines as there are buckets, which would evict each other from the cache and the TLB.
 template <unsigned int RadixBits,
-          typename DerivedPolicy,
+          bool HasValues,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename RandomAccessIterator3,
           typename RandomAccessIterator4,
-          typename Integer>
+          typename EncodedType,
+          typename KeyType,
+          typename ValueType>
 _CCCL_HOST_DEVICE void radix_shuffle_n(
-  sequential::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 keys_first,
   RandomAccessIterator2 values_first,
   const size_t n,
   RandomAccessIterator3 keys_result,
   RandomAccessIterator4 values_result,
-  Integer bit_shift,
-  size_t* histogram)
+  EncodedType bit_shift,
+  size_t* histogram,
+  KeyType* key_buffer,
+  ValueType* value_buffer)
 {
-  using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
+  const unsigned int HistogramSize = 1 << RadixBits;
+  const unsigned int BufferSize    = radix_sort_buffer_size<KeyType>::value;
+  const EncodedType BitMask        = static_cast<EncodedType>((1 << RadixBits) - 1);
+
+  RadixEncoder<KeyType> encode;
+
+  // the number of keys in the buffer of every bucket
+  unsigned int buffer_fill[HistogramSize] = {0};
+
+  for (size_t i = 0; i < n; i++)
+  {
+    const KeyType key      = keys_first[i];
+    const unsigned int b   = static_cast<unsigned int>((encode(key) >> bit_shift) & BitMask);
+    const unsigned int pos = b * BufferSize + buffer_fill[b];
+
+    key_buffer[pos] = key;
+
+    if (HasValues)
+    {
+      value_buffer[pos] = values_first[i];
+    }
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(
-    exec,
-    thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
-    thrust::make_zip_iterator(thrust::make_tuple(keys_first + n, values_first + n)),
-    thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits, KeyType>(bit_shift, histogram)),
-    thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)));
+    if (++buffer_fill[b] == BufferSize)
+    {
+      const size_t j = histogram[b];
+
+      for (unsigned int k = 0; k < BufferSize; k++)
+      {
+        keys_result[j + k] = key_buffer[b * BufferSize + k];
+
+        if (HasValues)
+        {
+          values_result[j + k] = value_buffer[b * BufferSize + k];
+        }
+      }
+
+      histogram[b] += BufferSize;
+      buffer_fill[b] = 0;
+    }
+  }
+
+  // write out what is left in the buffers
+  for (unsigned int b = 0; b < HistogramSize; b++)
+  {
+    const size_t j = histogram[b];
+
+    for (unsigned int k = 0; k < buffer_fill[b]; k++)
+    {
+      keys_result[j + k] = key_buffer[b * BufferSize + k];
+
+      if (HasValues)
+      {
+        values_result[j + k] = value_buffer[b * BufferSize + k];
+      }
+    }
+
+    histogram[b] += buffer_fill[b];
+  }
 }
 
 template <unsigned int RadixBits,
@@ -247,13 +305,15 @@ _CCCL_HOST_DEVICE void radix_sort(
   RandomAccessIterator4 vals2,
   const size_t N)
 {
-  using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator3>;
 
   using Encoder     = RadixEncoder<KeyType>;
   using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
 
   const unsigned int NumHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
   const unsigned int HistogramSize = 1 << RadixBits;
+  const unsigned int BufferSize    = radix_sort_buffer_size<KeyType>::value;
 
   const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
@@ -268,7 +328,7 @@ _CCCL_HOST_DEVICE void radix_sort(
   // false if most recent data is stored in (keys1,vals1)
   bool flip = false;
 
-  // compute histograms
+  // compute the histograms of all digits in a single pass over the keys
   for (size_t i = 0; i < N; i++)
   {
     const EncodedType x = encode(keys1[i]);
@@ -280,7 +340,7 @@ _CCCL_HOST_DEVICE void radix_sort(
     }
   }
 
-  // scan histograms
+  // scan histograms; a digit that is the same for all keys, like the high digits of small integers, is skipped
   for (unsigned int i = 0; i < NumHistograms; i++)
   {
     size_t sum = 0;
@@ -300,6 +360,18 @@ _CCCL_HOST_DEVICE void radix_sort(
     }
   }
 
+  // the buffers hold as many values as keys, which only pays off while the values are as small as scalars
+  const bool write_combining = RadixBits >= radix_sort_write_combining_bits
+                            && N >= radix_sort_write_combining_threshold && (!HasValues || sizeof(ValueType) <= 8);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> key_buffer(
+    exec, write_combining ? HistogramSize * BufferSize : 0);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> value_buffer(
+    exec, write_combining && HasValues ? HistogramSize * BufferSize : 0);
+
+  KeyType* key_buffer_ptr     = thrust::raw_pointer_cast(key_buffer.data());
+  ValueType* value_buffer_ptr = thrust::raw_pointer_cast(value_buffer.data());
+
   // shuffle keys and (optionally) values
   for (unsigned int i = 0; i < NumHistograms; i++)
   {
@@ -307,26 +379,28 @@ _CCCL_HOST_DEVICE void radix_sort(
 
     if (!skip_shuffle[i])
     {
-      if (flip)
+      if (write_combining)
       {
-        if (HasValues)
+        if (flip)
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues>(
+            keys2, vals2, N, keys1, vals1, BitShift, histograms[i], key_buffer_ptr, value_buffer_ptr);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, N, keys1, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues>(
+            keys1, vals1, N, keys2, vals2, BitShift, histograms[i], key_buffer_ptr, value_buffer_ptr);
         }
       }
       else
       {
-        if (HasValues)
+        if (flip)
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues>(keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, N, keys2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits, HasValues>(keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
         }
       }
 
@@ -346,8 +420,10 @@ _CCCL_HOST_DEVICE void radix_sort(
   }
 }
 
-// Select best radix sort parameters based on sizeof(T) and input size
-// These particular values were determined through empirical testing on a Core i7 950 CPU
+// Select best radix sort parameters based on sizeof(T) and input size.
+// Wide digits take fewer passes over the keys, but their histograms cost more to scan than a small input takes to
+// sort, and scatter to more buckets than the cache holds lines for unless the scatter is write-combined.
+// XXX the digit widths and the sizes at which they change are a tuning opportunity
 template <size_t KeySize>
 struct radix_sort_dispatcher
 {};
@@ -382,6 +458,8 @@ struct radix_sort_dispatcher<1>
   }
 };
 
+// 16 bit digits would sort 2 byte keys in a single pass, but their histogram takes 512KB of stack and scatters to
+// far more buckets than the cache holds
 template <>
 struct radix_sort_dispatcher<2>
 {
@@ -392,20 +470,7 @@ struct radix_sort_dispatcher<2>
     RandomAccessIterator2 keys2,
     const size_t N)
   {
-#ifdef __QNX__
-    // XXX war for nvbug 200193674
-    const bool condition = true;
-#else
-    const bool condition = N < (1 << 16);
-#endif
-    if (condition)
-    {
-      radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<16, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
-    }
+    radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
   }
 
   template <typename DerivedPolicy,
@@ -421,20 +486,7 @@ struct radix_sort_dispatcher<2>
     RandomAccessIterator4 vals2,
     const size_t N)
   {
-#ifdef __QNX__
-    // XXX war for nvbug 200193674
-    const bool condition = true;
-#else
-    const bool condition = N < (1 << 15);
-#endif
-    if (condition)
-    {
-      radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<16, true>(exec, keys1, keys2, vals1, vals2, N);
-    }
+    radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
   }
 };
 
@@ -448,13 +500,13 @@ struct radix_sort_dispatcher<4>
     RandomAccessIterator2 keys2,
     const size_t N)
   {
-    if (N < (1 << 22))
+    if (N < (1 << 16))
     {
       radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
     }
     else
     {
-      radix_sort_detail::radix_sort<4, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
+      radix_sort_detail::radix_sort<11, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
     }
   }
 
@@ -471,13 +523,13 @@ struct radix_sort_dispatcher<4>
     RandomAccessIterator4 vals2,
     const size_t N)
   {
-    if (N < (1 << 22))
+    if (N < (1 << 16))
     {
       radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
     }
     else
     {
-      radix_sort_detail::radix_sort<3, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<11, true>(exec, keys1, keys2, vals1, vals2, N);
     }
   }
 };
@@ -492,13 +544,13 @@ struct radix_sort_dispatcher<8>
     RandomAccessIterator2 keys2,
     const size_t N)
   {
-    if (N < (1 << 21))
+    if (N < (1 << 16))
     {
       radix_sort_detail::radix_sort<8, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
     }
     else
     {
-      radix_sort_detail::radix_sort<4, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
+      radix_sort_detail::radix_sort<11, false>(exec, keys1, keys2, static_cast<int*>(0), static_cast<int*>(0), N);
     }
   }
 
@@ -515,13 +567,13 @@ struct radix_sort_dispatcher<8>
     RandomAccessIterator4 vals2,
     const size_t N)
   {
-    if (N < (1 << 21))
+    if (N < (1 << 16))
     {
       radix_sort_detail::radix_sort<8, true>(exec, keys1, keys2, vals1, vals2, N);
     }
     else
     {
-      radix_sort_detail::radix_sort<3, true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<11, true>(exec, keys1, keys2, vals1, vals2, N);
     }
   }
 };
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/vectorized_search.h>
+#include <thrust/system/omp/detail/binary_search.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+// Every interval of the values is first merged with the table for as long as
+// its values ascend, which costs O(1) per value for sorted probes. The values
+// left over after the first descent are searched independently, in an
+// Eytzinger layout of the table if it is large and queried often enough to pay
+// for the copy.
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Search>
+OutputIterator vectorized_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  Search search)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using namespace thrust::system::detail::internal;
+
+  using Size      = thrust::detail::it_difference_t<ForwardIterator>;
+  using Index     = thrust::detail::it_difference_t<InputIterator>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator>;
+
+  const Size n           = thrust::distance(begin, end);
+  const Index num_values = thrust::distance(values_begin, values_end);
+
+  if (num_values == 0)
+  {
+    return output;
+  }
+
+  uniform_decomposition<Index> decomp = thrust::system::omp::detail::default_decomposition(exec, num_values);
+
+  const Index num_intervals = decomp.size();
+
+  thrust::detail::temporary_array<Index, DerivedPolicy> stops(exec, num_intervals);
+  Index* stop = thrust::raw_pointer_cast(stops.data());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_intervals) if (num_intervals > 1))
+  for (Index t = 0; t < num_intervals; t++)
+  {
+    stop[t] = merge_search(begin, n, values_begin, output, decomp[t].begin(), decomp[t].end(), search);
+  }
+
+  Index remaining = 0;
+
+  for (Index t = 0; t < num_intervals; t++)
+  {
+    remaining += decomp[t].end() - stop[t];
+  }
+
+  if (remaining == 0)
+  {
+    return output + num_values;
+  }
+
+  if (static_cast<std::size_t>(n) * sizeof(ValueType) >= eytzinger_search_threshold
+      && static_cast<Size>(remaining) >= n)
+  {
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> layout(exec, n + 1);
+    thrust::detail::temporary_array<Size, DerivedPolicy> ranks(exec, n + 1);
+
+    ValueType* layout_ptr = thrust::raw_pointer_cast(layout.data());
+    Size* ranks_ptr       = thrust::raw_pointer_cast(ranks.data());
+
+    // XXX building the layout in parallel is a tuning opportunity
+    eytzinger_layout(begin, n, layout_ptr, ranks_ptr);
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(num_intervals) if (num_intervals > 1))
+    for (Index t = 0; t < num_intervals; t++)
+    {
+      eytzinger_search(layout_ptr, ranks_ptr, begin, n, values_begin, output, stop[t], decomp[t].end(), search);
+    }
+  }
+  else
+  {
+    THRUST_PRAGMA_OMP(parallel for num_threads(num_intervals) if (num_intervals > 1))
+    for (Index t = 0; t < num_intervals; t++)
+    {
+      independent_search(begin, n, values_begin, output, stop[t], decomp[t].end(), search);
+    }
+  }
+
+  return output + num_values;
+}
+
+} // end namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::lower_bound_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end lower_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::upper_bound_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end upper_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::binary_search_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end binary_search()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,8 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/select_intervals.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,6 +41,58 @@ namespace omp
 namespace detail
 {
 
+namespace copy_if_detail
+{
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
+struct body
+{
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator result;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+
+  body(InputIterator1 first, InputIterator2 stencil, OutputIterator result, Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , result(result)
+      , pred{pred}
+  {}
+
+  template <typename Size>
+  Size count(Size begin, Size end) const
+  {
+    Size n = 0;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (pred(stencil[i]))
+      {
+        ++n;
+      }
+    }
+
+    return n;
+  }
+
+  template <typename Size>
+  void write(Size begin, Size end, Size offset, Size) const
+  {
+    OutputIterator out = result + offset;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (pred(stencil[i]))
+      {
+        *out = first[i];
+        ++out;
+      }
+    }
+  }
+};
+
+} // end namespace copy_if_detail
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -49,8 +106,19 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::copy_if(thrust::seq, first, last, stencil, result, pred);
+  }
+
+  using Body = copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate>;
+
+  return result + select_intervals(exec, decomp, Body(first, stencil, result, pred));
 } // end copy_if()
 
 } // namespace detail
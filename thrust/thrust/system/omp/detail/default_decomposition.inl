@@ -26,11 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/default_decomposition.h>
-
-// don't attempt to #include this file without omp support
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-#  include <omp.h>
-#endif // omp support
+#include <thrust/system/omp/detail/tuning.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -40,8 +36,9 @@ namespace omp
 namespace detail
 {
 
-template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n)
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -52,11 +49,10 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
     thrust::detail::depend_on_instantiation<IndexType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
     "OpenMP compiler support is not enabled");
 
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
-#else
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
-#endif
+  // an input too small to give two threads a grain each is a single interval, which algorithms process serially
+  const IndexType num_threads = thrust::system::omp::detail::tuning_of(exec).threads(n);
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, num_threads);
 }
 
 } // end namespace detail
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/extrema.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace extrema_detail
+{
+
+template <bool FindMin, bool FindMax, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator, ForwardIterator>
+sequential_extrema(ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  if (FindMin && FindMax)
+  {
+    return thrust::minmax_element(thrust::seq, first, last, comp);
+  }
+  else if (FindMin)
+  {
+    return thrust::make_pair(thrust::min_element(thrust::seq, first, last, comp), last);
+  }
+  else
+  {
+    return thrust::make_pair(last, thrust::max_element(thrust::seq, first, last, comp));
+  }
+}
+
+// Every interval finds the first minimum and the first maximum of its elements.
+// The interval results are then combined in order with the strict comparison,
+// so ties still resolve to the first occurrence like in the sequential
+// algorithms.
+template <bool FindMin, bool FindMax, typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator, ForwardIterator> extrema(
+  execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return extrema_detail::sequential_extrema<FindMin, FindMax>(first, last, comp);
+  }
+
+  const Size num_intervals = decomp.size();
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> positions(exec, 2 * num_intervals);
+
+  Size* mins = thrust::raw_pointer_cast(positions.data());
+  Size* maxs = mins + num_intervals;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_intervals))
+  for (Size t = 0; t < num_intervals; t++)
+  {
+    ForwardIterator begin = first + decomp[t].begin();
+    ForwardIterator end   = first + decomp[t].end();
+
+    thrust::pair<ForwardIterator, ForwardIterator> result =
+      extrema_detail::sequential_extrema<FindMin, FindMax>(begin, end, comp);
+
+    mins[t] = result.first - first;
+    maxs[t] = result.second - first;
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_comp{comp};
+
+  Size imin = mins[0];
+  Size imax = maxs[0];
+
+  for (Size t = 1; t < num_intervals; t++)
+  {
+    if (FindMin && wrapped_comp(first[mins[t]], first[imin]))
+    {
+      imin = mins[t];
+    }
+
+    if (FindMax && wrapped_comp(first[imax], first[maxs[t]]))
+    {
+      imax = maxs[t];
+    }
+  }
+
+  return thrust::make_pair(first + imin, first + imax);
+}
+
+} // end namespace extrema_detail
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator
+max_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<false, true>(exec, first, last, comp).second;
+} // end max_element()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator
+min_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<true, false>(exec, first, last, comp).first;
+} // end min_element()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator, ForwardIterator>
+minmax_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<true, true>(exec, first, last, comp);
+} // end minmax_element()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
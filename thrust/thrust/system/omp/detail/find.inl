@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/distance.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/find.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// The range is searched in blocks which the threads claim in order, so they
+// all work at the front of the range. Each block first checks the position of
+// the earliest match found so far and is skipped if it lies behind it, so a
+// match near the front ends the search after a few blocks. mismatch and equal
+// are implemented with find_if and stop early the same way.
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  const tuning t = thrust::system::omp::detail::tuning_of(exec);
+
+  // XXX the default block size is a tuning opportunity
+  const Size block_size = t.dynamic ? Size(t.dynamic_chunk()) : Size(1 << 12);
+  const int team_size   = t.threads(n);
+
+  if (team_size <= 1 || n <= block_size)
+  {
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  const Size num_blocks = (n + block_size - 1) / block_size;
+
+  Size result = n;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(team_size) schedule(dynamic))
+  for (Size b = 0; b < num_blocks; b++)
+  {
+    const Size begin = b * block_size;
+    const Size end   = (n - begin > block_size) ? begin + block_size : n;
+
+    Size current;
+    THRUST_PRAGMA_OMP(atomic read)
+    current = result;
+
+    if (begin < current)
+    {
+      const Size i = thrust::find_if(thrust::seq, first + begin, first + end, pred) - first;
+
+      if (i != end)
+      {
+        THRUST_PRAGMA_OMP(critical)
+        {
+          if (i < result)
+          {
+            THRUST_PRAGMA_OMP(atomic write)
+            result = i;
+          }
+        }
+      }
+    }
+  }
+
+  return first + result;
+} // end find_if()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -31,6 +31,7 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,7 +42,8 @@ namespace detail
 {
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -64,11 +66,72 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = thrust::detail::it_difference_t<RandomAccessIterator>;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
+  const tuning t = thrust::system::omp::detail::tuning_of(exec);
+
+  // a range too small to give two threads a grain each does not enter a parallel region
+  const int team_size = t.threads(signed_n);
+  const int chunk     = t.dynamic_chunk();
+
+#if THRUST_OMP_HAS_SIMD
+  if (t.simd)
+  {
+    if (team_size <= 1)
+    {
+      THRUST_PRAGMA_OMP(simd)
+      for (DifferenceType i = 0; i < signed_n; ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        wrapped_f(*temp);
+      }
+    }
+    else if (t.dynamic)
+    {
+      THRUST_PRAGMA_OMP(parallel for simd num_threads(team_size) schedule(dynamic, chunk))
+      for (DifferenceType i = 0; i < signed_n; ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        wrapped_f(*temp);
+      }
+    }
+    else
+    {
+      THRUST_PRAGMA_OMP(parallel for simd num_threads(team_size) schedule(static))
+      for (DifferenceType i = 0; i < signed_n; ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        wrapped_f(*temp);
+      }
+    }
+
+    return first + n;
+  }
+#endif // THRUST_OMP_HAS_SIMD
+
+  if (team_size <= 1)
+  {
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
+  }
+  else if (t.dynamic)
+  {
+    THRUST_PRAGMA_OMP(parallel for num_threads(team_size) schedule(dynamic, chunk))
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
+  }
+  else
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    THRUST_PRAGMA_OMP(parallel for num_threads(team_size) schedule(static))
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
   }
 
   return first + n;
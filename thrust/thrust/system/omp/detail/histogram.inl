@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/omp/detail/histogram.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+// Every interval counts its samples into counters of its own, and the counters of the intervals are then merged
+// pairwise up a binary tree, so no thread ever waits on a lock or an atomic.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Binner>
+OutputIterator count_bins(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  Binner binner)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Sample = thrust::detail::it_value_t<RandomAccessIterator>;
+  using Size   = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  const Size n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::histogram_counters<Sample, Binner> counters(
+    binner, num_bins, static_cast<std::size_t>(n));
+
+  const std::size_t m = counters.size();
+
+  // every interval counts at least as many samples as it has counters to merge
+  Size max_intervals = static_cast<Size>(tuning_of(exec).threads(n));
+
+  if (max_intervals > n / static_cast<Size>(m))
+  {
+    max_intervals = n / static_cast<Size>(m);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, max_intervals > 1 ? max_intervals : 1);
+
+  const Size num_intervals = decomp.size() > 1 ? decomp.size() : Size(1);
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> private_counters(exec, num_intervals * m);
+  std::size_t* c = thrust::raw_pointer_cast(private_counters.data());
+
+  if (num_intervals <= 1)
+  {
+    for (std::size_t i = 0; i < m; i++)
+    {
+      c[i] = 0;
+    }
+
+    counters.count(first, n, c);
+
+    return counters.write(c, histogram);
+  }
+
+  THRUST_PRAGMA_OMP(parallel num_threads(static_cast<int>(num_intervals)))
+  {
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      std::size_t* mine = c + i * m;
+
+      // the thread which counts into the counters touches them first
+      for (std::size_t j = 0; j < m; j++)
+      {
+        mine[j] = 0;
+      }
+
+      counters.count(first + decomp[i].begin(), decomp[i].size(), mine);
+    }
+
+    for (Size stride = 1; stride < num_intervals; stride *= 2)
+    {
+      THRUST_PRAGMA_OMP(for schedule(static))
+      for (Size i = 0; i < num_intervals; i += 2 * stride)
+      {
+        if (i + stride < num_intervals)
+        {
+          counters.merge(c + i * m, c + (i + stride) * m);
+        }
+      }
+    }
+  }
+
+  return counters.write(c, histogram);
+}
+
+} // end namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using Sample = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  return histogram_detail::count_bins(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_even_binner<Sample, Level>(num_levels - 1, lower_level, upper_level));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_range_binner<RandomAccessIterator2>(levels_first, num_levels));
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
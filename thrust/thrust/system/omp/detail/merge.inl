@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace merge_detail
+{
+
+// Writes the output positions [lo, hi) of the stable merge of
+// [first1, first1 + n1) and [first2, first2 + n2) to [result + lo, result + hi).
+// Both ends of the slice are located along the merge path, so any number of
+// threads can produce disjoint slices of one merge independently and together
+// reproduce exactly the output of a single sequential merge.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_slice(RandomAccessIterator1 first1,
+                 Size n1,
+                 RandomAccessIterator2 first2,
+                 Size n2,
+                 RandomAccessIterator3 result,
+                 Size lo,
+                 Size hi,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::merge_path;
+
+  Size i_lo = merge_path(first1, n1, first2, n2, lo, comp);
+  Size i_hi = merge_path(first1, n1, first2, n2, hi, comp);
+  Size j_lo = lo - i_lo;
+  Size j_hi = hi - i_hi;
+
+  thrust::merge(thrust::seq, first1 + i_lo, first1 + i_hi, first2 + j_lo, first2 + j_hi, result + lo, comp);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename RandomAccessIterator5,
+          typename RandomAccessIterator6,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_slice_by_key(
+  RandomAccessIterator1 keys_first1,
+  Size n1,
+  RandomAccessIterator2 keys_first2,
+  Size n2,
+  RandomAccessIterator3 values_first1,
+  RandomAccessIterator4 values_first2,
+  RandomAccessIterator5 keys_result,
+  RandomAccessIterator6 values_result,
+  Size lo,
+  Size hi,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::internal::merge_path;
+
+  Size i_lo = merge_path(keys_first1, n1, keys_first2, n2, lo, comp);
+  Size i_hi = merge_path(keys_first1, n1, keys_first2, n2, hi, comp);
+  Size j_lo = lo - i_lo;
+  Size j_hi = hi - i_hi;
+
+  thrust::merge_by_key(
+    thrust::seq,
+    keys_first1 + i_lo,
+    keys_first1 + i_hi,
+    keys_first2 + j_lo,
+    keys_first2 + j_hi,
+    values_first1 + i_lo,
+    values_first2 + j_lo,
+    keys_result + lo,
+    values_result + lo,
+    comp);
+}
+
+} // end namespace merge_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>& exec,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                          thrust::detail::it_difference_t<InputIterator2>>;
+
+  const Size n1 = last1 - first1;
+  const Size n2 = last2 - first2;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n1 + n2);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+  const Size num_partitions = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_partitions))
+  for (Size p = 0; p < num_partitions; p++)
+  {
+    merge_detail::merge_slice(first1, n1, first2, n2, result, decomp[p].begin(), decomp[p].end(), comp);
+  }
+
+  return result + (n1 + n2);
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first3,
+  InputIterator4 values_first4,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                          thrust::detail::it_difference_t<InputIterator2>>;
+
+  const Size n1 = keys_last1 - keys_first1;
+  const Size n2 = keys_last2 - keys_first2;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n1 + n2);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::merge_by_key(
+      thrust::seq,
+      keys_first1,
+      keys_last1,
+      keys_first2,
+      keys_last2,
+      values_first3,
+      values_first4,
+      keys_result,
+      values_result,
+      comp);
+  }
+
+  const Size num_partitions = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_partitions))
+  for (Size p = 0; p < num_partitions; p++)
+  {
+    merge_detail::merge_slice_by_key(
+      keys_first1,
+      n1,
+      keys_first2,
+      n2,
+      values_first3,
+      values_first4,
+      keys_result,
+      values_result,
+      decomp[p].begin(),
+      decomp[p].end(),
+      comp);
+  }
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
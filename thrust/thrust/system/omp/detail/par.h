@@ -27,6 +27,7 @@
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +37,55 @@ namespace omp
 namespace detail
 {
 
+template <typename Derived>
+struct execute_with_tuning_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  tuning m_tuning;
+
+public:
+  _CCCL_HOST_DEVICE execute_with_tuning_base(const tuning& t = tuning())
+      : m_tuning(t)
+  {}
+
+  template <typename... Options>
+  Derived with(Options... options) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    (apply_option(result.m_tuning, options), ...);
+    return result;
+  }
+
+private:
+  friend tuning get_tuning(const execute_with_tuning_base& exec)
+  {
+    return exec.m_tuning;
+  }
+};
+
+struct execute_with_tuning : execute_with_tuning_base<execute_with_tuning>
+{
+  using base_t = execute_with_tuning_base<execute_with_tuning>;
+
+  _CCCL_HOST_DEVICE execute_with_tuning()
+      : base_t()
+  {}
+};
+
 struct par_t
     : thrust::system::omp::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::omp::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_tuning_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::omp::detail::execution_policy<par_t>()
   {}
+
+  // par.with(num_threads(8), schedule_dynamic(4096), grain(1 << 16)) tunes the algorithms it is passed to
+  template <typename... Options>
+  execute_with_tuning with(Options... options) const
+  {
+    return execute_with_tuning().with(options...);
+  }
 };
 
 } // namespace detail
@@ -40,12 +40,106 @@ namespace omp
 namespace detail
 {
 
+namespace partition_detail
+{
+
+// Elements whose stencil satisfies the predicate are written to out_true and
+// all others to out_false, both in their original order. The false elements of
+// an interval follow the ones of all preceding intervals, of which there are
+// `begin - offset`. In place, out_false equals out_true and the false elements
+// are placed after all `total` true ones.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+struct body
+{
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+  bool false_after_true;
+
+  body(InputIterator1 first,
+       InputIterator2 stencil,
+       OutputIterator1 out_true,
+       OutputIterator2 out_false,
+       Predicate pred,
+       bool false_after_true)
+      : first(first)
+      , stencil(stencil)
+      , out_true(out_true)
+      , out_false(out_false)
+      , pred{pred}
+      , false_after_true(false_after_true)
+  {}
+
+  template <typename Size>
+  Size count(Size begin, Size end) const
+  {
+    Size n = 0;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (pred(stencil[i]))
+      {
+        ++n;
+      }
+    }
+
+    return n;
+  }
+
+  template <typename Size>
+  void write(Size begin, Size end, Size offset, Size total) const
+  {
+    OutputIterator1 t = out_true + offset;
+    OutputIterator2 f = out_false + (begin - offset) + (false_after_true ? total : Size(0));
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (pred(stencil[i]))
+      {
+        *t = first[i];
+        ++t;
+      }
+      else
+      {
+        *f = first[i];
+        ++f;
+      }
+    }
+  }
+};
+
+} // end namespace partition_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  using Size      = thrust::detail::it_difference_t<ForwardIterator>;
+  using InputType = thrust::detail::it_value_t<ForwardIterator>;
+  using TempRange = thrust::detail::temporary_array<InputType, DerivedPolicy>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::stable_partition(thrust::seq, first, last, pred);
+  }
+
+  // the threads cannot partition in place, so set the input aside and write
+  // both partitions back into [first, last)
+  TempRange temp(exec, first, last);
+
+  using Body = partition_detail::
+    body<typename TempRange::iterator, typename TempRange::iterator, ForwardIterator, ForwardIterator, Predicate>;
+
+  return first + select_intervals(exec, decomp, Body(temp.begin(), temp.begin(), first, first, pred, true));
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -56,8 +150,26 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  using Size      = thrust::detail::it_difference_t<ForwardIterator>;
+  using InputType = thrust::detail::it_value_t<ForwardIterator>;
+  using TempRange = thrust::detail::temporary_array<InputType, DerivedPolicy>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::stable_partition(thrust::seq, first, last, stencil, pred);
+  }
+
+  // the threads cannot partition in place, so set the input aside and write
+  // both partitions back into [first, last)
+  TempRange temp(exec, first, last);
+
+  using Body =
+    partition_detail::body<typename TempRange::iterator, InputIterator, ForwardIterator, ForwardIterator, Predicate>;
+
+  return first + select_intervals(exec, decomp, Body(temp.begin(), stencil, first, first, pred, true));
 } // end stable_partition()
 
 template <typename DerivedPolicy,
@@ -73,8 +185,7 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return thrust::system::omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -92,8 +203,23 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::stable_partition_copy(thrust::seq, first, last, stencil, out_true, out_false, pred);
+  }
+
+  using Body = partition_detail::body<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, Predicate>;
+
+  const Size num_true = select_intervals(exec, decomp, Body(first, stencil, out_true, out_false, pred, false));
+
+  return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
 } // end stable_partition_copy()
 
 } // end namespace detail
@@ -52,3 +52,11 @@
 #else
 #  define THRUST_PRAGMA_OMP(directive)
 #endif
+
+// For internal use only -- THRUST_OMP_HAS_SIMD tells whether the simd
+// directives of OpenMP 4.0 may be used with THRUST_PRAGMA_OMP.
+#if defined(_OPENMP) && _OPENMP >= 201307
+#  define THRUST_OMP_HAS_SIMD 1
+#else
+#  define THRUST_OMP_HAS_SIMD 0
+#endif
@@ -25,8 +25,16 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/distance.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -36,6 +44,126 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+// Every interval writes the key of each segment that starts in it and the value of each segment that ends in it.
+// A segment ends at its tail, the last element before a key that is not equivalent to the one of the segment, so
+// the output position of an element is the number of tails before it. The part of a segment which is still open at
+// the end of an interval is reduced ahead of the writes, and is carried into the first segment of the next interval.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct body
+{
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+  BinaryFunction binary_op;
+
+  body(InputIterator1 keys_first,
+       InputIterator2 values_first,
+       OutputIterator1 keys_output,
+       OutputIterator2 values_output,
+       BinaryPredicate binary_pred,
+       BinaryFunction binary_op)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , keys_output(keys_output)
+      , values_output(values_output)
+      , binary_pred{binary_pred}
+      , binary_op(binary_op)
+  {}
+
+  template <typename Size>
+  bool is_tail(Size i, Size n) const
+  {
+    return i + 1 == n || !binary_pred(keys_first[i], keys_first[i + 1]);
+  }
+
+  // counts the tails of the interval and returns the begin of the segment left open at its end, whose partial
+  // reduction is stored to partial unless the segment is empty
+  template <typename Size>
+  Size count(Size begin, Size end, Size n, Size& num_tails, ValueType& partial) const
+  {
+    Size open_begin = end;
+
+    while (open_begin > begin && !is_tail(open_begin - 1, n))
+    {
+      --open_begin;
+    }
+
+    num_tails = 0;
+
+    for (Size i = begin; i < open_begin; i++)
+    {
+      if (is_tail(i, n))
+      {
+        ++num_tails;
+      }
+    }
+
+    if (open_begin < end)
+    {
+      ValueType sum = values_first[open_begin];
+
+      for (Size i = open_begin + 1; i < end; i++)
+      {
+        sum = binary_op(sum, values_first[i]);
+      }
+
+      partial = sum;
+    }
+
+    return open_begin;
+  }
+
+  // writes the segments which end before open_begin, folding the carry into the first of them
+  template <typename Size>
+  void write(Size begin, Size open_begin, Size end, Size n, Size offset, bool has_carry, const ValueType& carry) const
+  {
+    Size k = offset;
+
+    if (!has_carry)
+    {
+      keys_output[k] = keys_first[begin];
+    }
+
+    for (Size i = begin; i < open_begin; i++)
+    {
+      ValueType sum = values_first[i];
+
+      if (i == begin && has_carry)
+      {
+        sum = binary_op(carry, sum);
+      }
+
+      // every comparison inside the segment is made once
+      while (!is_tail(i, n))
+      {
+        ++i;
+        sum = binary_op(sum, values_first[i]);
+      }
+
+      values_output[k] = sum;
+      ++k;
+
+      if (i + 1 < end)
+      {
+        keys_output[k] = keys_first[i + 1];
+      }
+    }
+  }
+};
+
+} // end namespace reduce_by_key_detail
 
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -54,9 +182,81 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size      = thrust::detail::it_difference_t<InputIterator1>;
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+  using Body      = reduce_by_key_detail::
+    body<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, BinaryPredicate, BinaryFunction>;
+
+  const Size n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::reduce_by_key(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  const Size num_intervals = decomp.size();
+
+  Body body(keys_first, values_first, keys_output, values_output, binary_pred, binary_op);
+
+  // an offset, the begin of the open segment and a carry per interval is all the extra storage we need; the partial
+  // reduction of the open segment of interval i is stored to carry[i + 1] and then turned into its carry
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> open_begins(exec, num_intervals);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_intervals + 1);
+  thrust::detail::temporary_array<bool, DerivedPolicy> has_carries(exec, num_intervals + 1);
+
+  Size* off        = thrust::raw_pointer_cast(offsets.data());
+  Size* open_begin = thrust::raw_pointer_cast(open_begins.data());
+  ValueType* carry = thrust::raw_pointer_cast(carries.data());
+  bool* has_carry  = thrust::raw_pointer_cast(has_carries.data());
+
+  off[0]       = 0;
+  has_carry[0] = false;
+
+  THRUST_PRAGMA_OMP(parallel num_threads(num_intervals))
+  {
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      open_begin[i] = body.count(decomp[i].begin(), decomp[i].end(), n, off[i + 1], carry[i + 1]);
+    }
+
+    // a segment which spans several intervals accumulates their partial reductions from left to right, which keeps
+    // binary_op's operands in order
+    THRUST_PRAGMA_OMP(single)
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      off[i + 1] += off[i];
+
+      has_carry[i + 1] = open_begin[i] < decomp[i].end();
+
+      if (has_carry[i + 1] && has_carry[i] && open_begin[i] == decomp[i].begin())
+      {
+        carry[i + 1] = binary_op(carry[i], carry[i + 1]);
+      }
+    }
+
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      body.write(decomp[i].begin(), open_begin[i], decomp[i].end(), n, off[i], has_carry[i], carry[i]);
+    }
+  }
+
+  return thrust::make_pair(keys_output + off[num_intervals], values_output + off[num_intervals]);
 } // end reduce_by_key()
 
 } // namespace detail
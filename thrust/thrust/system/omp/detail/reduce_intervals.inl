@@ -29,6 +29,7 @@
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
 #include <cstdint>
@@ -47,7 +48,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -58,9 +59,9 @@ void reduce_intervals(
   // X Note to the user: If you've found this line due to a compiler error, X
   // X you need to enable OpenMP support in your compiler.                  X
   // ========================================================================
-  static_assert(
-    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
-    "OpenMP compiler support is not enabled");
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using OutputType = thrust::detail::it_value_t<OutputIterator>;
@@ -72,7 +73,11 @@ void reduce_intervals(
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
+  // a single interval, like the second level of reduce, is not worth a parallel region
+  const index_type max_threads = thrust::system::omp::detail::tuning_of(exec).max_threads();
+  const int team_size          = static_cast<int>(n <= 1 ? 1 : n < max_threads ? n : max_threads);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(team_size) if (team_size > 1))
   for (index_type i = 0; i < n; i++)
   {
     InputIterator begin = input + decomp[i].begin();
@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cuda/std/__functional/invoke.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+template <typename InputIterator, typename OutputIterator, typename ValueType, typename BinaryFunction>
+void inclusive_scan_tile(
+  InputIterator first, InputIterator last, OutputIterator result, ValueType sum, BinaryFunction binary_op)
+{
+  for (; first != last; ++first, (void) ++result)
+  {
+    *result = sum = binary_op(sum, *first);
+  }
+}
+
+template <typename InputIterator, typename OutputIterator, typename ValueType, typename BinaryFunction>
+void exclusive_scan_tile(
+  InputIterator first, InputIterator last, OutputIterator result, ValueType sum, BinaryFunction binary_op)
+{
+  for (; first != last; ++first, (void) ++result)
+  {
+    ValueType tmp = *first; // temporary value allows in-situ scan
+    *result       = sum;
+    sum           = binary_op(sum, tmp);
+  }
+}
+
+// Upsweep of the reduce-then-scan: reduces every tile of decomp in parallel
+// and scans the tile sums in place, so that tile_sums[i] holds the reduction
+// of tiles [0, i].
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename ValueType,
+          typename BinaryFunction,
+          typename Decomposition>
+void upsweep(execution_policy<DerivedPolicy>& exec,
+             InputIterator first,
+             thrust::detail::temporary_array<ValueType, DerivedPolicy>& tile_sums,
+             BinaryFunction binary_op,
+             Decomposition decomp)
+{
+  thrust::system::omp::detail::reduce_intervals(exec, first, tile_sums.begin(), binary_op, decomp);
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  ValueType* sums = thrust::raw_pointer_cast(tile_sums.data());
+
+  for (typename Decomposition::index_type i = 1; i < decomp.size(); ++i)
+  {
+    sums[i] = wrapped_binary_op(sums[i - 1], sums[i]);
+  }
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = thrust::detail::it_value_t<InputIterator>;
+  using Size      = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, decomp.size());
+  scan_detail::upsweep(exec, first, tile_sums, binary_op, decomp);
+
+  const ValueType* sums = thrust::raw_pointer_cast(tile_sums.data());
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    InputIterator tile_first   = first + decomp[i].begin();
+    InputIterator tile_last    = first + decomp[i].end();
+    OutputIterator tile_result = result + decomp[i].begin();
+
+    if (i == 0)
+    {
+      ValueType sum = *tile_first;
+      *tile_result  = sum;
+      scan_detail::inclusive_scan_tile(++tile_first, tile_last, ++tile_result, sum, wrapped_binary_op);
+    }
+    else
+    {
+      scan_detail::inclusive_scan_tile(tile_first, tile_last, tile_result, sums[i - 1], wrapped_binary_op);
+    }
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type and the initial value type per wg21.link/p2322
+  using ValueType =
+    typename ::cuda::std::__accumulator_t<BinaryFunction, thrust::detail::it_value_t<InputIterator>, InitialValueType>;
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, decomp.size());
+  scan_detail::upsweep(exec, first, tile_sums, binary_op, decomp);
+
+  const ValueType* sums = thrust::raw_pointer_cast(tile_sums.data());
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    ValueType carry = (i == 0) ? ValueType(init) : wrapped_binary_op(init, sums[i - 1]);
+
+    scan_detail::inclusive_scan_tile(
+      first + decomp[i].begin(), first + decomp[i].end(), result + decomp[i].begin(), carry, wrapped_binary_op);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+  using Size      = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, decomp.size());
+  scan_detail::upsweep(exec, first, tile_sums, binary_op, decomp);
+
+  const ValueType* sums = thrust::raw_pointer_cast(tile_sums.data());
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    ValueType carry = (i == 0) ? init : wrapped_binary_op(init, sums[i - 1]);
+
+    scan_detail::exclusive_scan_tile(
+      first + decomp[i].begin(), first + decomp[i].end(), result + decomp[i].begin(), carry, wrapped_binary_op);
+  }
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
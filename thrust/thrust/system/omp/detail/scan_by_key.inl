@@ -0,0 +1,331 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+// Per-tile summary produced by the upsweep. `tail` is the reduction of the
+// last run of equal keys in the tile, `has_head` records whether that run
+// starts inside the tile, and `continues` records whether the tile's first key
+// belongs to the same segment as the last key of the preceding tile.
+template <typename ValueType>
+struct tile_state
+{
+  ValueType tail;
+  bool has_head;
+  bool continues;
+};
+
+// Reduces the trailing segment of every tile, then scans the tile summaries so
+// that carries[i] holds the partial reduction of the segment which is still
+// open when tile i begins. carries[i] is only meaningful if tile i continues
+// that segment.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename ValueType,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename Decomposition>
+void upsweep(execution_policy<DerivedPolicy>&,
+             InputIterator1 keys,
+             InputIterator2 values,
+             tile_state<ValueType>* tiles,
+             ValueType* carries,
+             BinaryPredicate binary_pred,
+             BinaryFunction binary_op,
+             Decomposition decomp)
+{
+  using KeyType = thrust::detail::it_value_t<InputIterator1>;
+  using Size    = typename Decomposition::index_type;
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    InputIterator1 key_iter   = keys + begin;
+    InputIterator2 value_iter = values + begin;
+
+    KeyType prev_key = *key_iter;
+    ValueType sum    = *value_iter;
+    bool has_head    = false;
+
+    for (Size j = begin + 1; j < end; j++)
+    {
+      KeyType key = *++key_iter;
+
+      if (binary_pred(prev_key, key))
+      {
+        sum = binary_op(sum, *++value_iter);
+      }
+      else
+      {
+        sum      = *++value_iter;
+        has_head = true;
+      }
+
+      prev_key = key;
+    }
+
+    tiles[i].tail      = sum;
+    tiles[i].has_head  = has_head;
+    tiles[i].continues = false;
+
+    if (i > 0)
+    {
+      KeyType last_key   = keys[begin - 1];
+      KeyType first_key  = keys[begin];
+      tiles[i].continues = binary_pred(last_key, first_key);
+    }
+  }
+
+  ValueType open = tiles[0].tail;
+
+  for (Size i = 1; i < num_tiles; i++)
+  {
+    carries[i] = open;
+
+    if (tiles[i].continues && !tiles[i].has_head)
+    {
+      open = binary_op(open, tiles[i].tail);
+    }
+    else
+    {
+      open = tiles[i].tail;
+    }
+  }
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using KeyType   = thrust::detail::it_value_t<InputIterator1>;
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+  using Size      = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n = thrust::distance(first1, last1);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::detail::temporary_array<scan_by_key_detail::tile_state<ValueType>, DerivedPolicy> tiles(exec, decomp.size());
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+
+  scan_by_key_detail::tile_state<ValueType>* tiles_ptr = thrust::raw_pointer_cast(tiles.data());
+  ValueType* carries_ptr                               = thrust::raw_pointer_cast(carries.data());
+
+  scan_by_key_detail::upsweep(
+    exec, first1, first2, tiles_ptr, carries_ptr, binary_pred, wrapped_binary_op, decomp);
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    InputIterator1 key_iter    = first1 + begin;
+    InputIterator2 value_iter  = first2 + begin;
+    OutputIterator result_iter = result + begin;
+
+    KeyType prev_key = *key_iter;
+    ValueType sum    = tiles_ptr[i].continues ? wrapped_binary_op(carries_ptr[i], *value_iter) : ValueType(*value_iter);
+
+    *result_iter = sum;
+
+    for (Size j = begin + 1; j < end; j++)
+    {
+      KeyType key = *++key_iter;
+
+      if (binary_pred(prev_key, key))
+      {
+        sum = wrapped_binary_op(sum, *++value_iter);
+      }
+      else
+      {
+        sum = *++value_iter;
+      }
+
+      *++result_iter = sum;
+
+      prev_key = key;
+    }
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using KeyType   = thrust::detail::it_value_t<InputIterator1>;
+  using ValueType = T;
+  using Size      = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n = thrust::distance(first1, last1);
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::detail::temporary_array<scan_by_key_detail::tile_state<ValueType>, DerivedPolicy> tiles(exec, decomp.size());
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+
+  scan_by_key_detail::tile_state<ValueType>* tiles_ptr = thrust::raw_pointer_cast(tiles.data());
+  ValueType* carries_ptr                               = thrust::raw_pointer_cast(carries.data());
+
+  scan_by_key_detail::upsweep(
+    exec, first1, first2, tiles_ptr, carries_ptr, binary_pred, wrapped_binary_op, decomp);
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_tiles))
+  for (Size i = 0; i < num_tiles; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    InputIterator1 key_iter    = first1 + begin;
+    InputIterator2 value_iter  = first2 + begin;
+    OutputIterator result_iter = result + begin;
+
+    KeyType prev_key     = *key_iter;
+    ValueType temp_value = *value_iter; // temporary value allows in-situ scan
+    ValueType next       = tiles_ptr[i].continues ? wrapped_binary_op(init, carries_ptr[i]) : init;
+
+    *result_iter = next;
+    next         = wrapped_binary_op(next, temp_value);
+
+    for (Size j = begin + 1; j < end; j++)
+    {
+      KeyType key = *++key_iter;
+      temp_value  = *++value_iter;
+
+      if (!binary_pred(prev_key, key))
+      {
+        next = init; // reset sum
+      }
+
+      *++result_iter = next;
+      next           = wrapped_binary_op(next, temp_value);
+
+      prev_key = key;
+    }
+  }
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/internal/segmented_sort.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
+#include <thrust/system/omp/detail/tuning.h>
+#include <thrust/transform_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace segmented_sort_detail
+{
+
+template <typename DerivedPolicy, typename OffsetIterator1, typename OffsetIterator2, typename Sorter>
+void sort_segments(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  Sorter sorter)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<OffsetIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Segments = thrust::system::detail::internal::segmented_sort_segments<OffsetIterator1, OffsetIterator2>;
+  using Size     = typename Segments::Size;
+
+  const Size num_segments = static_cast<Size>(thrust::distance(begin_offsets_first, begin_offsets_last));
+
+  if (num_segments <= 0)
+  {
+    return;
+  }
+
+  const Segments segments(begin_offsets_first, end_offsets_first);
+
+  // every thread sorts a part of the small segments with about as many elements as the others
+  thrust::detail::temporary_array<Size, DerivedPolicy> packed_ends(exec, num_segments);
+  thrust::transform_inclusive_scan(
+    exec,
+    thrust::counting_iterator<Size>(0),
+    thrust::counting_iterator<Size>(num_segments),
+    packed_ends.begin(),
+    segments,
+    thrust::plus<Size>());
+
+  const Size* ends = thrust::raw_pointer_cast(packed_ends.data());
+
+  const Size num_parts = tuning_of(exec).threads(ends[num_segments - 1]);
+
+  if (num_parts <= 1)
+  {
+    segments.sort_small(sorter, Size(0), num_segments);
+  }
+  else
+  {
+    THRUST_PRAGMA_OMP(parallel for schedule(static, 1) num_threads(static_cast<int>(num_parts)))
+    for (Size part = 0; part < num_parts; part++)
+    {
+      segments.sort_small(sorter,
+                          Segments::part_begin(ends, num_segments, part, num_parts),
+                          Segments::part_begin(ends, num_segments, part + 1, num_parts));
+    }
+  }
+
+  segments.sort_large(exec, sorter, num_segments);
+}
+
+} // end namespace segmented_sort_detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::keys_sorter<RandomAccessIterator, StrictWeakOrdering>(
+      first, comp));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::
+      pairs_sorter<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>(keys_first, values_first, comp));
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file select_intervals.h
+ *  \brief OpenMP implementation of the two-pass stream compaction
+ *         underlying copy_if, unique_copy and stable_partition_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// Every interval of decomp first reports how many elements it selects through
+// body.count(begin, end). After a scan of the counts, body.write(begin, end,
+// offset, total) produces the output of the interval, which starts at `offset`
+// of the `total` selected elements. Returns the total.
+template <typename DerivedPolicy, typename Decomposition, typename Body>
+typename Decomposition::index_type
+select_intervals(execution_policy<DerivedPolicy>& exec, Decomposition decomp, Body body);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/select_intervals.inl>
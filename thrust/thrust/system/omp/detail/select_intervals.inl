@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/select_intervals.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename Decomposition, typename Body>
+typename Decomposition::index_type
+select_intervals(execution_policy<DerivedPolicy>& exec, Decomposition decomp, Body body)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<Body, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using Size = typename Decomposition::index_type;
+
+  const Size num_intervals = decomp.size();
+
+  // one offset per interval is all the extra storage we need
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_intervals + 1);
+
+  Size* off = thrust::raw_pointer_cast(offsets.data());
+
+  off[0] = 0;
+
+  THRUST_PRAGMA_OMP(parallel num_threads(num_intervals))
+  {
+    // both passes use the same static schedule, so every thread revisits the
+    // intervals it has just counted while they are likely still in its cache
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      off[i + 1] = body.count(decomp[i].begin(), decomp[i].end());
+    }
+
+    THRUST_PRAGMA_OMP(single)
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      off[i + 1] += off[i];
+    }
+
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size i = 0; i < num_intervals; i++)
+    {
+      body.write(decomp[i].begin(), decomp[i].end(), off[i], off[num_intervals]);
+    }
+  }
+
+  return off[num_intervals];
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/select_intervals.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = thrust::detail::it_value_t<RandomIterator>;
+
+  // the output cannot be gathered in place, so shuffle a copy of the input back into it
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  omp::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+}
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using Size = std::int64_t;
+  using Body = thrust::system::detail::internal::shuffle_body<RandomIterator, OutputIterator>;
+
+  const std::uint64_t m = last - first;
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  // every interval of the domain of the bijection selects its values that index into the input
+  const Size n = static_cast<Size>(bijection.nearest_power_of_two());
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  Body body(m, bijection, first, result);
+
+  if (decomp.size() <= 1)
+  {
+    body.write(Size(0), n, Size(0));
+    return;
+  }
+
+  select_intervals(exec, decomp, body);
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
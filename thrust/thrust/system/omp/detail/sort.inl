@@ -31,13 +31,24 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,53 +60,94 @@ namespace detail
 namespace sort_detail
 {
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Runs of `width` tiles are merged pairwise from src into dst. Every thread
+// contributes the slice of the output which lines up with its own tile, so the
+// whole team stays busy at every level instead of halving at each step.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Decomposition,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_level(RandomAccessIterator1 src,
+                 RandomAccessIterator2 dst,
+                 const Decomposition& decomp,
+                 Size width,
+                 Size lo,
+                 Size hi,
+                 StrictWeakOrdering comp)
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  const Size nseg = decomp.size();
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  for (Size a = 0; a < nseg; a += 2 * width)
+  {
+    Size begin = decomp[a].begin();
+    Size mid   = decomp[::cuda::std::min(a + width, nseg) - 1].end();
+    Size end   = decomp[::cuda::std::min(a + 2 * width, nseg) - 1].end();
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    Size part_lo = ::cuda::std::max(begin, lo);
+    Size part_hi = ::cuda::std::min(end, hi);
+
+    if (part_lo < part_hi)
+    {
+      merge_detail::merge_slice(
+        src + begin, mid - begin, src + mid, end - mid, dst + begin, part_lo - begin, part_hi - begin, comp);
+    }
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
+template <typename RandomAccessIterator1,
           typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Decomposition,
+          typename Size,
           typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
+void merge_level_by_key(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  const Decomposition& decomp,
+  Size width,
+  Size lo,
+  Size hi,
   StrictWeakOrdering comp)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  const Size nseg = decomp.size();
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  for (Size a = 0; a < nseg; a += 2 * width)
+  {
+    Size begin = decomp[a].begin();
+    Size mid   = decomp[::cuda::std::min(a + width, nseg) - 1].end();
+    Size end   = decomp[::cuda::std::min(a + 2 * width, nseg) - 1].end();
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+    Size part_lo = ::cuda::std::max(begin, lo);
+    Size part_hi = ::cuda::std::min(end, hi);
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+    if (part_lo < part_hi)
+    {
+      merge_detail::merge_slice_by_key(
+        keys_src + begin,
+        mid - begin,
+        keys_src + mid,
+        end - mid,
+        values_src + begin,
+        values_src + mid,
+        keys_dst + begin,
+        values_dst + begin,
+        part_lo - begin,
+        part_hi - begin,
+        comp);
+    }
+  }
 }
 
-} // namespace sort_detail
-
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -108,14 +160,26 @@ void stable_sort(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const int team_size = thrust::system::omp::detail::tuning_of(exec).threads(last - first);
+
+  if (team_size <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  // a single scratch buffer which the merge levels ping-pong against
+  thrust::detail::temporary_array<value_type, DerivedPolicy> scratch(exec, last - first);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(team_size))
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
 
@@ -133,33 +197,32 @@ void stable_sort(
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+    // the slice of every merge level's output written by this thread
+    IndexType lo = p_i < decomp.size() ? decomp[p_i].begin() : IndexType(0);
+    IndexType hi = p_i < decomp.size() ? decomp[p_i].end() : IndexType(0);
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    bool in_scratch = false;
 
-    while (nseg > 1)
+    for (IndexType width = 1; width < decomp.size(); width *= 2)
     {
-      if (c >= decomp.size())
+      if (in_scratch)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_level(scratch.begin(), first, decomp, width, lo, hi, comp);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_level(first, scratch.begin(), decomp, width, lo, hi, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_scratch = !in_scratch;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    if (in_scratch && lo < hi)
+    {
+      thrust::copy(thrust::seq, scratch.begin() + lo, scratch.begin() + hi, first + lo);
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -173,7 +236,8 @@ void stable_sort_by_key(
   RandomAccessIterator1 keys_first,
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -186,14 +250,28 @@ void stable_sort_by_key(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using IndexType   = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const int team_size = thrust::system::omp::detail::tuning_of(exec).threads(keys_last - keys_first);
+
+  if (team_size <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  // a single pair of scratch buffers which the merge levels ping-pong against
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_scratch(exec, keys_last - keys_first);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> values_scratch(exec, keys_last - keys_first);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(team_size))
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
       keys_last - keys_first, 1, omp_get_num_threads());
@@ -217,42 +295,327 @@ void stable_sort_by_key(
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+    // the slice of every merge level's output written by this thread
+    IndexType lo = p_i < decomp.size() ? decomp[p_i].begin() : IndexType(0);
+    IndexType hi = p_i < decomp.size() ? decomp[p_i].end() : IndexType(0);
+
+    bool in_scratch = false;
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    for (IndexType width = 1; width < decomp.size(); width *= 2)
+    {
+      if (in_scratch)
+      {
+        sort_detail::merge_level_by_key(
+          keys_scratch.begin(), values_scratch.begin(), keys_first, values_first, decomp, width, lo, hi, comp);
+      }
+      else
+      {
+        sort_detail::merge_level_by_key(
+          keys_first, values_first, keys_scratch.begin(), values_scratch.begin(), decomp, width, lo, hi, comp);
+      }
+
+      in_scratch = !in_scratch;
 
-    while (nseg > 1)
+      THRUST_PRAGMA_OMP(barrier)
+    }
+
+    if (in_scratch && lo < hi)
     {
-      if (c >= decomp.size())
+      thrust::copy(thrust::seq, keys_scratch.begin() + lo, keys_scratch.begin() + hi, keys_first + lo);
+      thrust::copy(thrust::seq, values_scratch.begin() + lo, values_scratch.begin() + hi, values_first + lo);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// One LSD pass over all tiles, from (keys_src, values_src) to (keys_dst,
+// values_dst). Every thread of the team has to call this; `moves` is shared
+// and tells the team whether the pass actually scattered the keys.
+template <bool HasValues,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Decomposition,
+          typename Size,
+          typename Digit>
+void radix_sort_pass(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  const Decomposition& decomp,
+  Size n,
+  Digit digit,
+  std::size_t* histograms,
+  std::size_t* totals,
+  bool& moves)
+{
+  using namespace thrust::system::detail::internal;
+
+  const Size num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(for schedule(static))
+  for (Size t = 0; t < num_tiles; t++)
+  {
+    radix_sort_histogram(keys_src, decomp[t].begin(), decomp[t].end(), digit, histograms + t * Digit::num_buckets);
+  }
+
+  THRUST_PRAGMA_OMP(for schedule(static))
+  for (int b = 0; b < static_cast<int>(Digit::num_buckets); b++)
+  {
+    totals[b] = radix_sort_bucket_scan(histograms, num_tiles, Digit::num_buckets, b);
+  }
+
+  THRUST_PRAGMA_OMP(single)
+  moves = radix_sort_bucket_offsets(totals, Digit::num_buckets, n);
+
+  if (moves)
+  {
+    THRUST_PRAGMA_OMP(for schedule(static))
+    for (Size t = 0; t < num_tiles; t++)
+    {
+      if (HasValues)
       {
-        c = decomp.size() - 1;
+        radix_sort_scatter_by_key(
+          keys_src,
+          values_src,
+          keys_dst,
+          values_dst,
+          decomp[t].begin(),
+          decomp[t].end(),
+          digit,
+          totals,
+          histograms + t * Digit::num_buckets);
       }
+      else
+      {
+        radix_sort_scatter(
+          keys_src, keys_dst, decomp[t].begin(), decomp[t].end(), digit, totals, histograms + t * Digit::num_buckets);
+      }
+    }
+  }
+}
+
+// LSD radix sort of primitive keys: every pass builds per-tile histograms,
+// scans them per digit and scatters each tile at its own offsets, ping-ponging
+// between the input and a scratch buffer.
+template <bool HasValues,
+          bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys,
+                RandomAccessIterator2 values,
+                Size n,
+                const thrust::system::detail::internal::uniform_decomposition<Size>& decomp)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+  using Digit     = thrust::system::detail::internal::radix_sort_digit<KeyType, Descending>;
 
-      if ((p_i % h) == 0 && c > b)
+  const unsigned int num_passes = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_passes;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_scratch(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_scratch(exec, HasValues ? n : Size(0));
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, decomp.size() * Digit::num_buckets);
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> totals(exec, Digit::num_buckets);
+
+  std::size_t* hist = thrust::raw_pointer_cast(histograms.data());
+  std::size_t* tot  = thrust::raw_pointer_cast(totals.data());
+
+  bool moves = false;
+
+  THRUST_PRAGMA_OMP(parallel num_threads(decomp.size()))
+  {
+    bool in_scratch = false;
+
+    for (unsigned int pass = 0; pass < num_passes; pass++)
+    {
+      if (in_scratch)
+      {
+        radix_sort_pass<HasValues>(
+          keys_scratch.begin(), values_scratch.begin(), keys, values, decomp, n, Digit(pass), hist, tot, moves);
+      }
+      else
       {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
+        radix_sort_pass<HasValues>(
+          keys, values, keys_scratch.begin(), values_scratch.begin(), decomp, n, Digit(pass), hist, tot, moves);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      if (moves)
+      {
+        in_scratch = !in_scratch;
+      }
 
+      // moves is rewritten by the next pass
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    if (in_scratch)
+    {
+      const Size num_tiles = decomp.size();
+
+      THRUST_PRAGMA_OMP(for schedule(static))
+      for (Size t = 0; t < num_tiles; t++)
+      {
+        thrust::copy(thrust::seq,
+                     keys_scratch.begin() + decomp[t].begin(),
+                     keys_scratch.begin() + decomp[t].end(),
+                     keys + decomp[t].begin());
+
+        if (HasValues)
+        {
+          thrust::copy(thrust::seq,
+                       values_scratch.begin() + decomp[t].begin(),
+                       values_scratch.begin() + decomp[t].end(),
+                       values + decomp[t].begin());
+        }
+      }
+    }
+  }
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const IndexType n = last - first;
+
+  const tuning t = thrust::system::omp::detail::tuning_of(exec);
+
+  // a tile is at least a grain, and large enough to amortize its histograms
+  const IndexType granularity = ::cuda::std::max<IndexType>(
+    thrust::system::detail::internal::radix_sort_tile_granularity, static_cast<IndexType>(t.grain));
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, granularity, t.max_threads());
+
+  // the sequential backend has its own radix sort for inputs which fit into a single tile
+  if (decomp.size() <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  using thrust::system::detail::sequential::sort_detail::needs_reverse;
+
+  if (needs_reverse<KeyType, StrictWeakOrdering>::value)
+  {
+    sort_detail::radix_sort<false, true>(exec, first, static_cast<int*>(0), n, decomp);
+  }
+  else
+  {
+    sort_detail::radix_sort<false, false>(exec, first, static_cast<int*>(0), n, decomp);
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  // Avoid issues on compilers that don't provide `omp_get_max_threads()`.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  const IndexType n = keys_last - keys_first;
+
+  const tuning t = thrust::system::omp::detail::tuning_of(exec);
+
+  // a tile is at least a grain, and large enough to amortize its histograms
+  const IndexType granularity = ::cuda::std::max<IndexType>(
+    thrust::system::detail::internal::radix_sort_tile_granularity, static_cast<IndexType>(t.grain));
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, granularity, t.max_threads());
+
+  // the sequential backend has its own radix sort for inputs which fit into a single tile
+  if (decomp.size() <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  using thrust::system::detail::sequential::sort_detail::needs_reverse;
+
+  if (needs_reverse<KeyType, StrictWeakOrdering>::value)
+  {
+    sort_detail::radix_sort<true, true>(exec, keys_first, values_first, n, decomp);
+  }
+  else
+  {
+    sort_detail::radix_sort<true, false>(exec, keys_first, values_first, n, decomp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  thrust::system::detail::internal::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  thrust::system::detail::internal::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_radix_sort);
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+/*! \file tuning.h
+ *  \brief Per-call controls of how the OpenMP backend runs its parallel loops.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// The tuning of the parallel loops of an algorithm. The defaults leave the number of threads and the schedule
+// to the OpenMP runtime, and run inputs of fewer than two grains without entering a parallel region.
+struct tuning
+{
+  // XXX the default grain is a tuning opportunity; it should amortize forking a team for a cheap functor
+  static constexpr std::ptrdiff_t default_grain = 1 << 12;
+
+  // zero takes omp_get_max_threads()
+  int num_threads;
+  // schedule(dynamic, chunk) instead of schedule(static) for the loops over elements
+  bool dynamic;
+  // zero takes the grain
+  std::ptrdiff_t chunk;
+  // the fewest elements worth giving a thread
+  std::ptrdiff_t grain;
+  // vectorize the loops over elements with omp simd
+  bool simd;
+
+  _CCCL_HOST_DEVICE constexpr tuning()
+      : num_threads(0)
+      , dynamic(false)
+      , chunk(0)
+      , grain(default_grain)
+      , simd(false)
+  {}
+
+  int max_threads() const
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    return num_threads > 0 ? num_threads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  // the number of threads worth running a loop over n elements on; one means the loop runs serially
+  template <typename Size>
+  int threads(Size n) const
+  {
+    const int max = max_threads();
+
+    if (n <= 0 || max <= 1)
+    {
+      return 1;
+    }
+
+    // every thread gets at least a grain
+    const std::ptrdiff_t t = static_cast<std::ptrdiff_t>(n) / (grain > 0 ? grain : 1);
+
+    return t <= 1 ? 1 : t < max ? static_cast<int>(t) : max;
+  }
+
+  int dynamic_chunk() const
+  {
+    const std::ptrdiff_t c = chunk > 0 ? chunk : grain;
+
+    return c > 1 ? static_cast<int>(c < (1 << 30) ? c : (1 << 30)) : 1;
+  }
+};
+
+struct num_threads_option
+{
+  int value;
+};
+
+struct schedule_option
+{
+  bool dynamic;
+  std::ptrdiff_t chunk;
+};
+
+struct grain_option
+{
+  std::ptrdiff_t value;
+};
+
+struct simd_option
+{};
+
+inline void apply_option(tuning& t, num_threads_option o)
+{
+  t.num_threads = o.value > 0 ? o.value : 0;
+}
+
+inline void apply_option(tuning& t, schedule_option o)
+{
+  t.dynamic = o.dynamic;
+  t.chunk   = o.chunk > 0 ? o.chunk : 0;
+}
+
+inline void apply_option(tuning& t, grain_option o)
+{
+  t.grain = o.value > 0 ? o.value : 1;
+}
+
+inline void apply_option(tuning& t, simd_option)
+{
+  t.simd = true;
+}
+
+// policies which carry a tuning provide a get_tuning overload found by ADL
+template <typename Derived>
+tuning get_tuning(execution_policy<Derived>&)
+{
+  return tuning();
+}
+
+template <typename Derived>
+tuning tuning_of(execution_policy<Derived>& policy)
+{
+  return get_tuning(thrust::detail::derived_cast(policy));
+}
+
+} // end namespace detail
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+/*! Caps the number of threads an algorithm run with <tt>thrust::omp::par.with(...)</tt> uses.
+ *
+ *  \param n The largest number of threads; zero leaves it to \c omp_get_max_threads().
+ */
+inline detail::num_threads_option num_threads(int n)
+{
+  return detail::num_threads_option{n};
+}
+
+/*! Splits the loops over elements of an algorithm run with <tt>thrust::omp::par.with(...)</tt> evenly among
+ *  its threads, which is the default.
+ */
+inline detail::schedule_option schedule_static()
+{
+  return detail::schedule_option{false, 0};
+}
+
+/*! Lets the threads of an algorithm run with <tt>thrust::omp::par.with(...)</tt> take chunks of its loops over
+ *  elements as they become idle, which balances functors whose cost varies from element to element.
+ *
+ *  \param chunk The number of elements a thread takes at a time; zero takes the grain.
+ */
+inline detail::schedule_option schedule_dynamic(std::ptrdiff_t chunk = 0)
+{
+  return detail::schedule_option{true, chunk};
+}
+
+/*! Sets the fewest elements an algorithm run with <tt>thrust::omp::par.with(...)</tt> gives a thread. An input
+ *  of fewer than two grains runs on the calling thread without entering a parallel region.
+ *
+ *  \param n The grain size in elements.
+ */
+inline detail::grain_option grain(std::ptrdiff_t n)
+{
+  return detail::grain_option{n};
+}
+
+/*! Asks an algorithm run with <tt>thrust::omp::par.with(...)</tt> to vectorize its loops over elements with
+ *  <tt>omp simd</tt>. The functor must then be free of dependences between elements.
+ */
+inline detail::simd_option simd()
+{
+  return detail::simd_option{};
+}
+
+/*! \}
+ */
+
+} // end namespace omp
+} // end namespace system
+
+// alias the options here
+namespace omp
+{
+
+using thrust::system::omp::grain;
+using thrust::system::omp::num_threads;
+using thrust::system::omp::schedule_dynamic;
+using thrust::system::omp::schedule_static;
+using thrust::system::omp::simd;
+
+} // end namespace omp
+THRUST_NAMESPACE_END
@@ -25,9 +25,17 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/select_intervals.h>
 #include <thrust/system/omp/detail/unique.h>
+#include <thrust/unique.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,12 +44,69 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_detail
+{
+
+// An element is kept if it is the first one of its group of equivalent elements.
+template <typename InputIterator, typename OutputIterator, typename BinaryPredicate>
+struct body
+{
+  InputIterator first;
+  OutputIterator output;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  body(InputIterator first, OutputIterator output, BinaryPredicate binary_pred)
+      : first(first)
+      , output(output)
+      , binary_pred{binary_pred}
+  {}
+
+  template <typename Size>
+  bool is_head(Size i) const
+  {
+    return i == 0 || !binary_pred(first[i - 1], first[i]);
+  }
+
+  template <typename Size>
+  Size count(Size begin, Size end) const
+  {
+    Size n = 0;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (is_head(i))
+      {
+        ++n;
+      }
+    }
+
+    return n;
+  }
+
+  template <typename Size>
+  void write(Size begin, Size end, Size offset, Size) const
+  {
+    OutputIterator out = output + offset;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (is_head(i))
+      {
+        *out = first[i];
+        ++out;
+      }
+    }
+  }
+};
+
+} // end namespace unique_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
+  // the threads cannot compact in place, so let generic::unique copy the input
+  // aside and call unique_copy below
   return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
 } // end unique()
 
@@ -53,16 +118,58 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::unique_copy(thrust::seq, first, last, output, binary_pred);
+  }
+
+  using Body = unique_detail::body<InputIterator, OutputIterator, BinaryPredicate>;
+
+  return output + select_intervals(exec, decomp, Body(first, output, binary_pred));
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 thrust::detail::it_difference_t<ForwardIterator> unique_count(
   execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_count to cpp::unique_count
-  return thrust::system::detail::generic::unique_count(exec, first, last, binary_pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, last - first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::unique_count(thrust::seq, first, last, binary_pred);
+  }
+
+  const Size num_intervals = decomp.size();
+
+  // counting the heads of each interval is all the work there is
+  unique_detail::body<ForwardIterator, ForwardIterator, BinaryPredicate> body(first, first, binary_pred);
+
+  Size result = 0;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_intervals) reduction(+ : result))
+  for (Size i = 0; i < num_intervals; i++)
+  {
+    result += body.count(decomp[i].begin(), decomp[i].end());
+  }
+
+  return result;
 } // end unique_count()
 
 } // end namespace detail
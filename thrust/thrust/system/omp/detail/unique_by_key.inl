@@ -25,9 +25,15 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/select_intervals.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
+#include <thrust/unique.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,6 +42,78 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_by_key_detail
+{
+
+// A key and its value are kept if the key is the first one of its group of
+// equivalent keys.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+struct body
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  body(InputIterator1 keys_first,
+       InputIterator2 values_first,
+       OutputIterator1 keys_output,
+       OutputIterator2 values_output,
+       BinaryPredicate binary_pred)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , keys_output(keys_output)
+      , values_output(values_output)
+      , binary_pred{binary_pred}
+  {}
+
+  template <typename Size>
+  bool is_head(Size i) const
+  {
+    return i == 0 || !binary_pred(keys_first[i - 1], keys_first[i]);
+  }
+
+  template <typename Size>
+  Size count(Size begin, Size end) const
+  {
+    Size n = 0;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (is_head(i))
+      {
+        ++n;
+      }
+    }
+
+    return n;
+  }
+
+  template <typename Size>
+  void write(Size begin, Size end, Size offset, Size) const
+  {
+    OutputIterator1 keys_out   = keys_output + offset;
+    OutputIterator2 values_out = values_output + offset;
+
+    for (Size i = begin; i < end; i++)
+    {
+      if (is_head(i))
+      {
+        *keys_out   = keys_first[i];
+        *values_out = values_first[i];
+        ++keys_out;
+        ++values_out;
+      }
+    }
+  }
+};
+
+} // end namespace unique_by_key_detail
 
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
@@ -45,7 +123,8 @@ thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
+  // the threads cannot compact in place, so let generic::unique_by_key copy
+  // the input aside and call unique_by_key_copy below
   return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
 
@@ -64,9 +143,24 @@ thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, keys_last - keys_first);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::unique_by_key_copy(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  }
+
+  using Body =
+    unique_by_key_detail::body<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, BinaryPredicate>;
+
+  const Size n =
+    select_intervals(exec, decomp, Body(keys_first, values_first, keys_output, values_output, binary_pred));
+
+  return thrust::make_pair(keys_output + n, values_output + n);
 } // end unique_by_key_copy()
 
 } // end namespace detail
@@ -52,6 +52,7 @@
 #include <thrust/system/omp/detail/gather.h>
 #include <thrust/system/omp/detail/generate.h>
 #include <thrust/system/omp/detail/get_value.h>
+#include <thrust/system/omp/detail/histogram.h>
 #include <thrust/system/omp/detail/inner_product.h>
 #include <thrust/system/omp/detail/iter_swap.h>
 #include <thrust/system/omp/detail/logical.h>
@@ -67,8 +68,10 @@
 #include <thrust/system/omp/detail/scan.h>
 #include <thrust/system/omp/detail/scan_by_key.h>
 #include <thrust/system/omp/detail/scatter.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
 #include <thrust/system/omp/detail/sequence.h>
 #include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/omp/detail/shuffle.h>
 #include <thrust/system/omp/detail/sort.h>
 #include <thrust/system/omp/detail/swap_ranges.h>
 #include <thrust/system/omp/detail/tabulate.h>
@@ -146,6 +149,20 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  <tt>thrust::omp::par.with(options...)</tt> returns a policy which tunes the parallel loops of the
+ *  algorithms it is passed to. The options are \p thrust::omp::num_threads, \p thrust::omp::schedule_static,
+ *  \p thrust::omp::schedule_dynamic, \p thrust::omp::grain and \p thrust::omp::simd. By default, a range
+ *  too small to give two threads a grain each is processed without entering a parallel region.
+ *
+ *  \code
+ *  // at most 8 threads, which take 4096 elements at a time, and no parallel region below 2^17 elements
+ *  auto policy = thrust::omp::par.with(thrust::omp::num_threads(8),
+ *                                      thrust::omp::schedule_dynamic(4096),
+ *                                      thrust::omp::grain(1 << 16));
+ *
+ *  thrust::for_each(policy, vec.begin(), vec.end(), printf_functor());
+ *  \endcode
  */
 static const unspecified par;
 
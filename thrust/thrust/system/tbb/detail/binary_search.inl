@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/vectorized_search.h>
+#include <thrust/system/tbb/detail/binary_search.h>
+
+#include <cuda/std/__algorithm/max.h>
+
+#include <cstddef>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename Index,
+          typename Search>
+struct merge_search_body
+{
+  RandomAccessIterator1 table;
+  Size n;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 output;
+  thrust::system::detail::internal::uniform_decomposition<Index> decomp;
+  Index* stops;
+  Search search;
+
+  merge_search_body(RandomAccessIterator1 table,
+                    Size n,
+                    RandomAccessIterator2 values,
+                    RandomAccessIterator3 output,
+                    thrust::system::detail::internal::uniform_decomposition<Index> decomp,
+                    Index* stops,
+                    Search search)
+      : table(table)
+      , n(n)
+      , values(values)
+      , output(output)
+      , decomp(decomp)
+      , stops(stops)
+      , search(search)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Index>& r) const
+  {
+    for (Index t = r.begin(); t != r.end(); ++t)
+    {
+      stops[t] = thrust::system::detail::internal::merge_search(
+        table, n, values, output, decomp[t].begin(), decomp[t].end(), search);
+    }
+  }
+};
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename Index,
+          typename Search>
+struct independent_search_body
+{
+  RandomAccessIterator1 table;
+  Size n;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 output;
+  thrust::system::detail::internal::uniform_decomposition<Index> decomp;
+  const Index* stops;
+  Search search;
+
+  independent_search_body(RandomAccessIterator1 table,
+                          Size n,
+                          RandomAccessIterator2 values,
+                          RandomAccessIterator3 output,
+                          thrust::system::detail::internal::uniform_decomposition<Index> decomp,
+                          const Index* stops,
+                          Search search)
+      : table(table)
+      , n(n)
+      , values(values)
+      , output(output)
+      , decomp(decomp)
+      , stops(stops)
+      , search(search)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Index>& r) const
+  {
+    for (Index t = r.begin(); t != r.end(); ++t)
+    {
+      thrust::system::detail::internal::independent_search(
+        table, n, values, output, stops[t], decomp[t].end(), search);
+    }
+  }
+};
+
+template <typename T,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename Index,
+          typename Search>
+struct eytzinger_search_body
+{
+  const T* layout;
+  const Size* ranks;
+  RandomAccessIterator1 table;
+  Size n;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 output;
+  thrust::system::detail::internal::uniform_decomposition<Index> decomp;
+  const Index* stops;
+  Search search;
+
+  eytzinger_search_body(const T* layout,
+                        const Size* ranks,
+                        RandomAccessIterator1 table,
+                        Size n,
+                        RandomAccessIterator2 values,
+                        RandomAccessIterator3 output,
+                        thrust::system::detail::internal::uniform_decomposition<Index> decomp,
+                        const Index* stops,
+                        Search search)
+      : layout(layout)
+      , ranks(ranks)
+      , table(table)
+      , n(n)
+      , values(values)
+      , output(output)
+      , decomp(decomp)
+      , stops(stops)
+      , search(search)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Index>& r) const
+  {
+    for (Index t = r.begin(); t != r.end(); ++t)
+    {
+      thrust::system::detail::internal::eytzinger_search(
+        layout, ranks, table, n, values, output, stops[t], decomp[t].end(), search);
+    }
+  }
+};
+
+// Every interval of the values is first merged with the table for as long as
+// its values ascend, which costs O(1) per value for sorted probes. The values
+// left over after the first descent are searched independently, in an
+// Eytzinger layout of the table if it is large and queried often enough to pay
+// for the copy.
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Search>
+OutputIterator vectorized_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  Search search)
+{
+  using Size      = thrust::detail::it_difference_t<ForwardIterator>;
+  using Index     = thrust::detail::it_difference_t<InputIterator>;
+  using ValueType = thrust::detail::it_value_t<ForwardIterator>;
+
+  const Size n           = thrust::distance(begin, end);
+  const Index num_values = thrust::distance(values_begin, values_end);
+
+  // XXX the minimum number of values per interval is a tuning opportunity
+  const Index parallelism_threshold = 10000;
+
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  thrust::system::detail::internal::uniform_decomposition<Index> decomp(num_values, parallelism_threshold, p);
+
+  const Index num_intervals = decomp.size();
+
+  thrust::detail::temporary_array<Index, DerivedPolicy> stops(exec, num_intervals);
+  Index* stop = thrust::raw_pointer_cast(stops.data());
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<Index>(0, num_intervals, 1),
+    merge_search_body<ForwardIterator, InputIterator, OutputIterator, Size, Index, Search>(
+      begin, n, values_begin, output, decomp, stop, search));
+
+  Index remaining = 0;
+
+  for (Index t = 0; t < num_intervals; t++)
+  {
+    remaining += decomp[t].end() - stop[t];
+  }
+
+  if (remaining == 0)
+  {
+    return output + num_values;
+  }
+
+  if (static_cast<std::size_t>(n) * sizeof(ValueType) >= thrust::system::detail::internal::eytzinger_search_threshold
+      && static_cast<Size>(remaining) >= n)
+  {
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> layout(exec, n + 1);
+    thrust::detail::temporary_array<Size, DerivedPolicy> ranks(exec, n + 1);
+
+    ValueType* layout_ptr = thrust::raw_pointer_cast(layout.data());
+    Size* ranks_ptr       = thrust::raw_pointer_cast(ranks.data());
+
+    // XXX building the layout in parallel is a tuning opportunity
+    thrust::system::detail::internal::eytzinger_layout(begin, n, layout_ptr, ranks_ptr);
+
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Index>(0, num_intervals, 1),
+      eytzinger_search_body<ValueType, ForwardIterator, InputIterator, OutputIterator, Size, Index, Search>(
+        layout_ptr, ranks_ptr, begin, n, values_begin, output, decomp, stop, search));
+  }
+  else
+  {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Index>(0, num_intervals, 1),
+      independent_search_body<ForwardIterator, InputIterator, OutputIterator, Size, Index, Search>(
+        begin, n, values_begin, output, decomp, stop, search));
+  }
+
+  return output + num_values;
+}
+
+} // end namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::lower_bound_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end lower_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::upper_bound_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end upper_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using Search = thrust::system::detail::internal::binary_search_search<StrictWeakOrdering>;
+
+  return binary_search_detail::vectorized_search(exec, begin, end, values_begin, values_end, output, Search{{comp}});
+} // end binary_search()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
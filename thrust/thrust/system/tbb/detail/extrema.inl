@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/tbb/detail/extrema.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace extrema_detail
+{
+
+// Tracks the positions of the first minimum and the first maximum. TBB hands a
+// body its subranges from left to right and joins it with bodies of subranges
+// to its right, so combining results with the strict comparison keeps the
+// first occurrence of ties like the sequential algorithms.
+template <bool FindMin, bool FindMax, typename RandomAccessIterator, typename BinaryPredicate>
+struct body
+{
+  using Size = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  RandomAccessIterator first;
+  BinaryPredicate comp;
+  Size imin;
+  Size imax;
+  bool empty;
+
+  body(RandomAccessIterator first, BinaryPredicate comp)
+      : first(first)
+      , comp(comp)
+      , imin(0)
+      , imax(0)
+      , empty(true)
+  {}
+
+  body(body& b, ::tbb::split)
+      : first(b.first)
+      , comp(b.comp)
+      , imin(0)
+      , imax(0)
+      , empty(true)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r)
+  {
+    if (r.empty())
+    {
+      return;
+    }
+
+    RandomAccessIterator begin = first + r.begin();
+    RandomAccessIterator end   = first + r.end();
+
+    if (FindMin && FindMax)
+    {
+      thrust::pair<RandomAccessIterator, RandomAccessIterator> result =
+        thrust::minmax_element(thrust::seq, begin, end, comp);
+
+      accumulate(result.first - first, result.second - first);
+    }
+    else if (FindMin)
+    {
+      accumulate(thrust::min_element(thrust::seq, begin, end, comp) - first, Size(0));
+    }
+    else
+    {
+      accumulate(Size(0), thrust::max_element(thrust::seq, begin, end, comp) - first);
+    }
+  }
+
+  void join(body& b)
+  {
+    if (!b.empty)
+    {
+      accumulate(b.imin, b.imax);
+    }
+  }
+
+  void accumulate(Size jmin, Size jmax)
+  {
+    if (empty)
+    {
+      imin  = jmin;
+      imax  = jmax;
+      empty = false;
+      return;
+    }
+
+    thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_comp{comp};
+
+    if (FindMin && wrapped_comp(first[jmin], first[imin]))
+    {
+      imin = jmin;
+    }
+
+    if (FindMax && wrapped_comp(first[imax], first[jmax]))
+    {
+      imax = jmax;
+    }
+  }
+};
+
+template <bool FindMin, bool FindMax, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator, ForwardIterator>
+extrema(ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n == 0)
+  {
+    return thrust::make_pair(last, last);
+  }
+
+  body<FindMin, FindMax, ForwardIterator, BinaryPredicate> extrema_body(first, comp);
+  ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), extrema_body);
+
+  return thrust::make_pair(first + extrema_body.imin, first + extrema_body.imax);
+}
+
+} // end namespace extrema_detail
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator
+max_element(execution_policy<DerivedPolicy>&, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<false, true>(first, last, comp).second;
+} // end max_element()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator
+min_element(execution_policy<DerivedPolicy>&, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<true, false>(first, last, comp).first;
+} // end min_element()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator, ForwardIterator>
+minmax_element(execution_policy<DerivedPolicy>&, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
+{
+  return extrema_detail::extrema<true, true>(first, last, comp);
+} // end minmax_element()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/find.h>
+
+#include <atomic>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace find_detail
+{
+
+template <typename InputIterator, typename Size, typename Predicate>
+struct body
+{
+  InputIterator first;
+  Size n;
+  Size block_size;
+  std::atomic<Size>* result;
+  Predicate pred;
+
+  body(InputIterator first, Size n, Size block_size, std::atomic<Size>* result, Predicate pred)
+      : first(first)
+      , n(n)
+      , block_size(block_size)
+      , result(result)
+      , pred(pred)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size b = r.begin(); b != r.end(); ++b)
+    {
+      const Size begin = b * block_size;
+      const Size end   = (n - begin > block_size) ? begin + block_size : n;
+
+      // the remaining blocks of r lie even further behind the match
+      if (begin >= result->load(std::memory_order_relaxed))
+      {
+        return;
+      }
+
+      const Size i = thrust::find_if(thrust::seq, first + begin, first + end, pred) - first;
+
+      if (i != end)
+      {
+        Size current = result->load(std::memory_order_relaxed);
+
+        while (i < current && !result->compare_exchange_weak(current, i, std::memory_order_relaxed))
+        {
+        }
+
+        return;
+      }
+    }
+  }
+};
+
+} // end namespace find_detail
+
+// The range is searched in blocks, each of which first checks the position of
+// the earliest match found so far and is skipped if it lies behind it, so a
+// match near the front ends the search without scanning the rest of the range.
+// mismatch and equal are implemented with find_if and stop early the same way.
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy>&, InputIterator first, InputIterator last, Predicate pred)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+
+  const Size n = thrust::distance(first, last);
+
+  // XXX the block size is a tuning opportunity
+  const Size block_size = 1 << 12;
+
+  if (n <= block_size)
+  {
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  const Size num_blocks = (n + block_size - 1) / block_size;
+
+  std::atomic<Size> result(n);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_blocks, 1),
+                      find_detail::body<InputIterator, Size, Predicate>(first, n, block_size, &result, pred));
+
+  return first + result.load();
+} // end find_if()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
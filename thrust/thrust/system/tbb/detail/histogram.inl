@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/distance.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/tbb/detail/histogram.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+// A body counts the samples of its subranges into counters of its own. TBB joins the bodies pairwise up the tree
+// of its splits, which merges their counters without locks or atomics.
+template <typename RandomAccessIterator, typename Counters>
+struct body
+{
+  using Size = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  RandomAccessIterator first;
+  const Counters& counters;
+  std::vector<std::size_t> counts;
+
+  body(RandomAccessIterator first, const Counters& counters)
+      : first(first)
+      , counters(counters)
+      , counts(counters.size())
+  {}
+
+  body(body& b, ::tbb::split)
+      : first(b.first)
+      , counters(b.counters)
+      , counts(b.counters.size())
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r)
+  {
+    counters.count(first + r.begin(), r.size(), counts.data());
+  }
+
+  void join(body& b)
+  {
+    counters.merge(counts.data(), b.counts.data());
+  }
+};
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Binner>
+OutputIterator
+count_bins(RandomAccessIterator first, RandomAccessIterator last, OutputIterator histogram, int num_bins, Binner binner)
+{
+  using Sample   = thrust::detail::it_value_t<RandomAccessIterator>;
+  using Size     = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using Counters = thrust::system::detail::internal::histogram_counters<Sample, Binner>;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  const Size n = thrust::distance(first, last);
+
+  Counters counters(binner, num_bins, static_cast<std::size_t>(n));
+
+  // every subrange counts at least as many samples as its body has counters to merge
+  // XXX the grain size is a tuning opportunity; it should also amortize zeroing the counters of a split body
+  const Size grain_size = (std::max) (static_cast<Size>(counters.size()), Size(1 << 14));
+
+  body<RandomAccessIterator, Counters> histogram_body(first, counters);
+  ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n, grain_size), histogram_body);
+
+  return counters.write(histogram_body.counts.data(), histogram);
+}
+
+} // end namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using Sample = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  return histogram_detail::count_bins(
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_even_binner<Sample, Level>(num_levels - 1, lower_level, upper_level));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_bins(
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::generic::histogram_range_binner<RandomAccessIterator2>(levels_first, num_levels));
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
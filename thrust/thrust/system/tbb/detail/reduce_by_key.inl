@@ -91,7 +91,7 @@ reduce_last_segment_backward(
   for (++keys_first_r, ++values_first_r; (keys_first_r != keys_last_r) && binary_pred(*keys_first_r, result_key);
        ++keys_first_r, ++values_first_r)
   {
-    result_value = binary_op(result_value, *values_first_r);
+    result_value = binary_op(*values_first_r, result_value);
   }
 
   return thrust::make_pair(keys_first_r.base(), thrust::make_pair(result_key, result_value));
@@ -378,8 +378,10 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
 
   // sequentially accumulate the carries
   // note that the last interval does not have a carry
+  // the carries are applied from right to left so that binary_op sees its operands in order, also when a segment
+  // spans several intervals
   // XXX find a way to express this loop via a sequential algorithm, perhaps reduce_by_key
-  for (typename thrust::detail::temporary_array<carry_type, DerivedPolicy>::size_type i = 0; i < carries.size(); ++i)
+  for (typename thrust::detail::temporary_array<carry_type, DerivedPolicy>::size_type i = carries.size(); i-- > 0;)
   {
     // if our interval has a carry, then we need to sum the carry to the next interval's output offset
     // if it does not have a carry, then we need to ignore carry_value[i]
@@ -387,7 +389,7 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
     {
       difference_type output_idx = interval_output_offsets[i + 1];
 
-      values_result[output_idx] = binary_op(values_result[output_idx], carries[i]);
+      values_result[output_idx] = binary_op(carries[i], values_result[output_idx]);
     }
   }
 
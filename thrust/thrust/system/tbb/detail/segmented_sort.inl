@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/internal/segmented_sort.h>
+#include <thrust/system/tbb/detail/segmented_sort.h>
+#include <thrust/transform_scan.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace segmented_sort_detail
+{
+
+// Sorts the small segments of a range of parts.
+template <typename Segments, typename Sorter>
+struct body
+{
+  using Size = typename Segments::Size;
+
+  const Segments& segments;
+  const Size* packed_ends;
+  Size num_segments;
+  Size num_parts;
+  Sorter sorter;
+
+  body(const Segments& segments, const Size* packed_ends, Size num_segments, Size num_parts, Sorter sorter)
+      : segments(segments)
+      , packed_ends(packed_ends)
+      , num_segments(num_segments)
+      , num_parts(num_parts)
+      , sorter(sorter)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    segments.sort_small(sorter,
+                        Segments::part_begin(packed_ends, num_segments, r.begin(), num_parts),
+                        Segments::part_begin(packed_ends, num_segments, r.end(), num_parts));
+  }
+};
+
+template <typename DerivedPolicy, typename OffsetIterator1, typename OffsetIterator2, typename Sorter>
+void sort_segments(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  Sorter sorter)
+{
+  using Segments = thrust::system::detail::internal::segmented_sort_segments<OffsetIterator1, OffsetIterator2>;
+  using Size     = typename Segments::Size;
+
+  const Size num_segments = static_cast<Size>(thrust::distance(begin_offsets_first, begin_offsets_last));
+
+  if (num_segments <= 0)
+  {
+    return;
+  }
+
+  const Segments segments(begin_offsets_first, end_offsets_first);
+
+  // the small segments are packed into parts of about as many elements each, which TBB balances over its threads
+  thrust::detail::temporary_array<Size, DerivedPolicy> packed_ends(exec, num_segments);
+  thrust::transform_inclusive_scan(
+    exec,
+    thrust::counting_iterator<Size>(0),
+    thrust::counting_iterator<Size>(num_segments),
+    packed_ends.begin(),
+    segments,
+    thrust::plus<Size>());
+
+  const Size* ends = thrust::raw_pointer_cast(packed_ends.data());
+
+  // XXX the number of elements of a part is a tuning opportunity
+  const Size part_size = 1 << 14;
+  const Size num_parts = (ends[num_segments - 1] + part_size - 1) / part_size;
+
+  if (num_parts <= 1)
+  {
+    segments.sort_small(sorter, Size(0), num_segments);
+  }
+  else
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_parts, 1),
+                        body<Segments, Sorter>(segments, ends, num_segments, num_parts, sorter));
+  }
+
+  segments.sort_large(exec, sorter, num_segments);
+}
+
+} // end namespace segmented_sort_detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::keys_sorter<RandomAccessIterator, StrictWeakOrdering>(
+      first, comp));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OffsetIterator1,
+          typename OffsetIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1,
+  RandomAccessIterator2 values_first,
+  OffsetIterator1 begin_offsets_first,
+  OffsetIterator1 begin_offsets_last,
+  OffsetIterator2 end_offsets_first,
+  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments(
+    exec,
+    begin_offsets_first,
+    begin_offsets_last,
+    end_offsets_first,
+    thrust::system::detail::generic::segmented_sort_detail::
+      pairs_sorter<RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>(keys_first, values_first, comp));
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
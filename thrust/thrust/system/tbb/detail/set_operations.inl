@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/type_traits>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+template <typename Partitions>
+struct split_body
+{
+  const Partitions& partitions;
+
+  split_body(const Partitions& partitions)
+      : partitions(partitions)
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      partitions.split(p);
+    }
+  }
+};
+
+template <typename Partitions>
+struct count_body
+{
+  const Partitions& partitions;
+
+  count_body(const Partitions& partitions)
+      : partitions(partitions)
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      partitions.count(p);
+    }
+  }
+};
+
+template <typename Partitions, typename OutputIterator>
+struct write_body
+{
+  const Partitions& partitions;
+  OutputIterator result;
+
+  write_body(const Partitions& partitions, OutputIterator result)
+      : partitions(partitions)
+      , result(result)
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      partitions.write(p, result);
+    }
+  }
+};
+
+// Runs every step of the partitioned set operation as its own parallel_for, with a few partitions per thread for
+// TBB to balance.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                          thrust::detail::it_difference_t<InputIterator2>>;
+
+  const Size n1 = last1 - first1;
+  const Size n2 = last2 - first2;
+
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // XXX oversubscribing is a tuning opportunity
+  const unsigned int subscription_rate = 4;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(
+    n1 + n2,
+    static_cast<Size>(thrust::system::detail::internal::set_operation_partition_size),
+    static_cast<Size>(subscription_rate * p));
+
+  if (decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  using Partitions = thrust::system::detail::internal::
+    set_operation_partitions<DerivedPolicy, InputIterator1, InputIterator2, Size, StrictWeakOrdering, SetOperation>;
+
+  const Partitions partitions(exec, first1, n1, first2, n2, decomp, comp, set_op);
+
+  const ::tbb::blocked_range<Size> range(0, partitions.size(), 1);
+
+  ::tbb::parallel_for(range, split_body<Partitions>(partitions));
+  ::tbb::parallel_for(range, count_body<Partitions>(partitions));
+
+  partitions.scan();
+
+  ::tbb::parallel_for(range, write_body<Partitions, OutputIterator>(partitions, result));
+
+  return result + partitions.output_size();
+}
+
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union());
+} // end set_union()
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+
+#include <cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+// The pre-scan counts the selected values of a subrange of the domain of the bijection, and the final scan writes
+// them out after those of the subranges to its left. TBB skips the pre-scan of subranges it scans from the start.
+template <typename RandomIterator, typename OutputIterator>
+struct body
+{
+  using Size = std::int64_t;
+
+  thrust::system::detail::internal::shuffle_body<RandomIterator, OutputIterator> intervals;
+  Size sum;
+
+  body(const thrust::system::detail::internal::shuffle_body<RandomIterator, OutputIterator>& intervals)
+      : intervals(intervals)
+      , sum(0)
+  {}
+
+  body(body& b, ::tbb::split)
+      : intervals(b.intervals)
+      , sum(0)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    sum += intervals.count(r.begin(), r.end());
+  }
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    sum += intervals.write(r.begin(), r.end(), sum);
+  }
+
+  void reverse_join(body& b)
+  {
+    sum = b.sum + sum;
+  }
+
+  void assign(body& b)
+  {
+    sum = b.sum;
+  }
+}; // end body
+
+} // namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = thrust::detail::it_value_t<RandomIterator>;
+
+  // the output cannot be gathered in place, so shuffle a copy of the input back into it
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  tbb::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+}
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>&, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using Size = std::int64_t;
+
+  const std::uint64_t m = last - first;
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  // every subrange of the domain of the bijection selects its values that index into the input
+  const Size n = static_cast<Size>(bijection.nearest_power_of_two());
+
+  shuffle_detail::body<RandomIterator, OutputIterator> body(
+    thrust::system::detail::internal::shuffle_body<RandomIterator, OutputIterator>(m, bijection, first, result));
+
+  // XXX the grain size is a tuning opportunity; it should amortize a batch of bijection evaluations
+  ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, 1 << 14), body);
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,13 +26,24 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 
+#include <cuda/std/__algorithm/max.h>
+
+#include <cstddef>
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -256,9 +267,257 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+template <typename RandomAccessIterator, typename Size, typename Digit>
+struct histogram_body
+{
+  RandomAccessIterator keys;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  std::size_t* histograms;
+
+  histogram_body(RandomAccessIterator keys,
+                 thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+                 Digit digit,
+                 std::size_t* histograms)
+      : keys(keys)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size t = r.begin(); t != r.end(); ++t)
+    {
+      thrust::system::detail::internal::radix_sort_histogram(
+        keys, decomp[t].begin(), decomp[t].end(), digit, histograms + t * Digit::num_buckets);
+    }
+  }
+};
+
+template <typename Size>
+struct bucket_scan_body
+{
+  std::size_t* histograms;
+  std::size_t* totals;
+  Size num_tiles;
+  unsigned int num_buckets;
+
+  bucket_scan_body(std::size_t* histograms, std::size_t* totals, Size num_tiles, unsigned int num_buckets)
+      : histograms(histograms)
+      , totals(totals)
+      , num_tiles(num_tiles)
+      , num_buckets(num_buckets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<unsigned int>& r) const
+  {
+    for (unsigned int b = r.begin(); b != r.end(); ++b)
+    {
+      totals[b] = thrust::system::detail::internal::radix_sort_bucket_scan(histograms, num_tiles, num_buckets, b);
+    }
+  }
+};
+
+template <bool HasValues,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+struct scatter_body
+{
+  RandomAccessIterator1 keys_src;
+  RandomAccessIterator2 values_src;
+  RandomAccessIterator3 keys_dst;
+  RandomAccessIterator4 values_dst;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  Digit digit;
+  const std::size_t* histograms;
+  const std::size_t* totals;
+
+  scatter_body(RandomAccessIterator1 keys_src,
+               RandomAccessIterator2 values_src,
+               RandomAccessIterator3 keys_dst,
+               RandomAccessIterator4 values_dst,
+               thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+               Digit digit,
+               const std::size_t* histograms,
+               const std::size_t* totals)
+      : keys_src(keys_src)
+      , values_src(values_src)
+      , keys_dst(keys_dst)
+      , values_dst(values_dst)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+      , totals(totals)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    using namespace thrust::system::detail::internal;
+
+    for (Size t = r.begin(); t != r.end(); ++t)
+    {
+      if (HasValues)
+      {
+        radix_sort_scatter_by_key(
+          keys_src,
+          values_src,
+          keys_dst,
+          values_dst,
+          decomp[t].begin(),
+          decomp[t].end(),
+          digit,
+          totals,
+          histograms + t * Digit::num_buckets);
+      }
+      else
+      {
+        radix_sort_scatter(
+          keys_src, keys_dst, decomp[t].begin(), decomp[t].end(), digit, totals, histograms + t * Digit::num_buckets);
+      }
+    }
+  }
+};
+
+// One LSD pass from (keys_src, values_src) to (keys_dst, values_dst). Returns
+// false if every key falls into the same bucket and nothing was moved.
+template <bool HasValues,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename Digit>
+bool radix_sort_pass(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+  Size n,
+  Digit digit,
+  std::size_t* histograms,
+  std::size_t* totals)
+{
+  const Size num_tiles = decomp.size();
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                      histogram_body<RandomAccessIterator1, Size, Digit>(keys_src, decomp, digit, histograms));
+
+  // XXX the grain size of the bucket scan is a tuning opportunity
+  ::tbb::parallel_for(::tbb::blocked_range<unsigned int>(0, Digit::num_buckets, 16),
+                      bucket_scan_body<Size>(histograms, totals, num_tiles, Digit::num_buckets));
+
+  if (!thrust::system::detail::internal::radix_sort_bucket_offsets(totals, Digit::num_buckets, n))
+  {
+    return false;
+  }
+
+  using Body = scatter_body<HasValues,
+                            RandomAccessIterator1,
+                            RandomAccessIterator2,
+                            RandomAccessIterator3,
+                            RandomAccessIterator4,
+                            Size,
+                            Digit>;
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                      Body(keys_src, values_src, keys_dst, values_dst, decomp, digit, histograms, totals));
+
+  return true;
+}
+
+// LSD radix sort of primitive keys: every pass builds per-tile histograms,
+// scans them per digit and scatters each tile at its own offsets, ping-ponging
+// between the input and a scratch buffer.
+template <bool HasValues,
+          bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys,
+                RandomAccessIterator2 values,
+                Size n,
+                thrust::system::detail::internal::uniform_decomposition<Size> decomp)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+  using Digit     = thrust::system::detail::internal::radix_sort_digit<KeyType, Descending>;
+
+  const unsigned int num_passes = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_passes;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_scratch(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_scratch(exec, HasValues ? n : Size(0));
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, decomp.size() * Digit::num_buckets);
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> totals(exec, Digit::num_buckets);
+
+  std::size_t* hist = thrust::raw_pointer_cast(histograms.data());
+  std::size_t* tot  = thrust::raw_pointer_cast(totals.data());
+
+  bool in_scratch = false;
+
+  for (unsigned int pass = 0; pass < num_passes; pass++)
+  {
+    bool moved;
+
+    if (in_scratch)
+    {
+      moved = radix_sort_pass<HasValues>(
+        keys_scratch.begin(), values_scratch.begin(), keys, values, decomp, n, Digit(pass), hist, tot);
+    }
+    else
+    {
+      moved = radix_sort_pass<HasValues>(
+        keys, values, keys_scratch.begin(), values_scratch.begin(), decomp, n, Digit(pass), hist, tot);
+    }
+
+    if (moved)
+    {
+      in_scratch = !in_scratch;
+    }
+  }
+
+  if (in_scratch)
+  {
+    thrust::copy(exec, keys_scratch.begin(), keys_scratch.end(), keys);
+
+    if (HasValues)
+    {
+      thrust::copy(exec, values_scratch.begin(), values_scratch.end(), values);
+    }
+  }
+}
+
+template <typename Size>
+thrust::system::detail::internal::uniform_decomposition<Size> decompose(Size n)
+{
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  return thrust::system::detail::internal::uniform_decomposition<Size>(
+    n, thrust::system::detail::internal::radix_sort_tile_granularity, p);
+}
+
+} // namespace radix_sort_detail
+
+namespace sort_detail
+{
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
@@ -267,6 +526,44 @@ void stable_sort(
   sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
 }
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using key_type        = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const difference_type n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = radix_sort_detail::decompose(n);
+
+  // the sequential backend has its own radix sort for inputs which fit into a single tile
+  if (decomp.size() <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  using thrust::system::detail::sequential::sort_detail::needs_reverse;
+
+  if (needs_reverse<key_type, StrictWeakOrdering>::value)
+  {
+    radix_sort_detail::radix_sort<false, true>(exec, first, static_cast<int*>(0), n, decomp);
+  }
+  else
+  {
+    radix_sort_detail::radix_sort<false, false>(exec, first, static_cast<int*>(0), n, decomp);
+  }
+}
+
+} // end namespace sort_detail
+
+namespace sort_by_key_detail
+{
+
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
@@ -276,7 +573,8 @@ void stable_sort_by_key(
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
@@ -289,6 +587,75 @@ void stable_sort_by_key(
   sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using key_type        = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  const difference_type n = thrust::distance(first1, last1);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = radix_sort_detail::decompose(n);
+
+  // the sequential backend has its own radix sort for inputs which fit into a single tile
+  if (decomp.size() <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  using thrust::system::detail::sequential::sort_detail::needs_reverse;
+
+  if (needs_reverse<key_type, StrictWeakOrdering>::value)
+  {
+    radix_sort_detail::radix_sort<true, true>(exec, first1, first2, n, decomp);
+  }
+  else
+  {
+    radix_sort_detail::radix_sort<true, false>(exec, first1, first2, n, decomp);
+  }
+}
+
+} // end namespace sort_by_key_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  sort_by_key_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
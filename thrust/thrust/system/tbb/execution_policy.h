@@ -52,6 +52,7 @@
 #include <thrust/system/tbb/detail/gather.h>
 #include <thrust/system/tbb/detail/generate.h>
 #include <thrust/system/tbb/detail/get_value.h>
+#include <thrust/system/tbb/detail/histogram.h>
 #include <thrust/system/tbb/detail/inner_product.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/logical.h>
@@ -67,8 +68,10 @@
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/system/tbb/detail/scan_by_key.h>
 #include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/system/tbb/detail/segmented_sort.h>
 #include <thrust/system/tbb/detail/sequence.h>
 #include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/shuffle.h>
 #include <thrust/system/tbb/detail/sort.h>
 #include <thrust/system/tbb/detail/swap_ranges.h>
 #include <thrust/system/tbb/detail/tabulate.h>